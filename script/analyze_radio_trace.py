@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2025, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Rebuild per-frame timelines from a radio trace recorded with SL_OPENTHREAD_RADIO_TRACE_ENABLE.
+
+The entry layout and the event codes are described in src/src/radio_trace.h and src/src/sl_radio_extension.h.
+The input is either the entries returned by otPlatRadioExtensionGetRadioTrace(), oldest first, or with --ring
+a raw memory dump of the `sRadioTrace` ring taken from a halted device.
+
+Example:
+    ./script/analyze_radio_trace.py --ring --frames --threshold-us 5000 sRadioTrace.bin
+"""
+
+import argparse
+import struct
+import sys
+
+ENTRY = struct.Struct('<IBBH')
+COUNT = struct.Struct('<I')
+
+EVENT_NAMES = {
+    1: 'RX_SYNC',
+    2: 'RX_FILTER_PASSED',
+    3: 'RX_DATA_REQUEST',
+    4: 'RX_PACKET_RECEIVED',
+    5: 'RX_FRAME_ERROR',
+    6: 'RX_FILTERED',
+    7: 'TX_START_CCA',
+    8: 'TX_CCA_RETRY',
+    9: 'TX_STARTED',
+    10: 'TX_PACKET_SENT',
+    11: 'TX_CHANNEL_BUSY',
+    12: 'TX_BLOCKED',
+    13: 'TX_ABORTED',
+    14: 'TX_ACK_TIMEOUT',
+    15: 'TXACK_SENT',
+    16: 'TXACK_FAILED',
+    17: 'SCHEDULED_TX_STARTED',
+    18: 'SCHEDULED_TX_MISSED',
+    19: 'SCHEDULED_RX_STARTED',
+    20: 'SCHEDULED_RX_END',
+    21: 'SCHEDULER_STATUS',
+    22: 'CAL_NEEDED',
+    32: 'TRANSMIT',
+    33: 'TX_DONE',
+    34: 'RECEIVE_DONE',
+}
+EVENT_CODES = {name: code for code, name in EVENT_NAMES.items()}
+
+# Events whose flags hold the sequence number of the frame being sent.
+TX_FRAME_EVENTS = {
+    EVENT_CODES[name] for name in ('TX_START_CCA', 'TX_CCA_RETRY', 'TX_STARTED', 'TX_PACKET_SENT', 'TX_CHANNEL_BUSY',
+                                   'TX_BLOCKED', 'TX_ABORTED', 'TX_ACK_TIMEOUT', 'SCHEDULED_TX_STARTED',
+                                   'SCHEDULED_TX_MISSED')
+}
+RX_ERROR_EVENTS = {EVENT_CODES['RX_FRAME_ERROR'], EVENT_CODES['RX_FILTERED']}
+
+OT_ERRORS = {0: 'NONE', 11: 'ABORT', 14: 'NO_ACK', 15: 'CHANNEL_ACCESS_FAILURE'}
+
+
+def elapsed(start, end):
+    """Microseconds from start to end, accounting for the wrap of the 32-bit RAIL time."""
+    if start is None or end is None:
+        return None
+    return (end - start) & 0xFFFFFFFF
+
+
+def read_entries(data, ring):
+    """Returns the (timestamp, event, iid, flags) entries of a capture, oldest first."""
+    if not ring:
+        usable = len(data) - len(data) % ENTRY.size
+        return [ENTRY.unpack_from(data, offset) for offset in range(0, usable, ENTRY.size)]
+
+    # A dump of the ring is the entry array followed by the number of entries recorded.
+    size = (len(data) - COUNT.size) // ENTRY.size
+    if size <= 0 or size & (size - 1):
+        raise ValueError('ring dump size does not match a power of two number of entries')
+    (count,) = COUNT.unpack_from(data, size * ENTRY.size)
+    available = min(count, size)
+    return [ENTRY.unpack_from(data, ((count - available + index) % size) * ENTRY.size) for index in range(available)]
+
+
+class TxFrame:
+
+    def __init__(self, iid, sequence):
+        self.iid = iid
+        self.sequence = sequence
+        self.request = None
+        self.first_cca = None
+        self.cca_attempts = 0
+        self.tx_start = None
+        self.sent = None
+        self.ack = None
+        self.done = None
+        self.status = None
+        self.failure = None
+
+    def metrics(self):
+        return {
+            'transmit_to_tx_start': elapsed(self.request, self.tx_start),
+            'tx_start_to_tx_done': elapsed(self.tx_start, self.done),
+            'transmit_to_tx_done': elapsed(self.request, self.done),
+            'csma_backoff': elapsed(self.first_cca, self.tx_start),
+            'ack_wait': elapsed(self.sent, self.ack),
+        }
+
+    def describe(self):
+        status = OT_ERRORS.get(self.status, str(self.status))
+        timings = ' '.join(f'{name}={value}us' for name, value in self.metrics().items() if value is not None)
+        failure = f' failure={self.failure}' if self.failure else ''
+        return (f'[{self.done or self.request or 0:010d}] TX iid={self.iid} seq={self.sequence:3d} status={status} '
+                f'cca_attempts={self.cca_attempts}{failure} {timings}')
+
+
+class RxFrame:
+
+    def __init__(self, sync):
+        self.sync = sync
+        self.filter_passed = None
+        self.ack_sent = None
+        self.received = None
+        self.done = None
+        self.iid = None
+        self.status = None
+
+    def metrics(self):
+        return {
+            'rx_sync_to_ack_sent': elapsed(self.sync, self.ack_sent),
+            'rx_sync_to_receive_done': elapsed(self.sync, self.done),
+        }
+
+    def describe(self):
+        status = OT_ERRORS.get(self.status, str(self.status))
+        timings = ' '.join(f'{name}={value}us' for name, value in self.metrics().items() if value is not None)
+        return f'[{self.sync:010d}] RX iid={self.iid} status={status} acked={self.ack_sent is not None} {timings}'
+
+
+def build_timelines(entries):
+    """Matches the trace entries into completed transmit and receive timelines."""
+
+    tx_frames = []
+    rx_frames = []
+    open_tx = {}
+    active_tx = None
+    receiving = None
+    delivered = []
+
+    for timestamp, event, iid, flags in entries:
+        if event == EVENT_CODES['TRANSMIT']:
+            # A multipan request deferred while the radio was busy is traced again when it is replayed.
+            frame = open_tx.setdefault((iid, flags), TxFrame(iid, flags))
+            frame.request = frame.request or timestamp
+
+        elif event in TX_FRAME_EVENTS:
+            frame = open_tx.setdefault((iid, flags), TxFrame(iid, flags))
+            active_tx = (iid, flags)
+
+            if event == EVENT_CODES['TX_START_CCA']:
+                frame.cca_attempts += 1
+                frame.first_cca = frame.first_cca or timestamp
+            elif event in (EVENT_CODES['TX_STARTED'], EVENT_CODES['SCHEDULED_TX_STARTED']):
+                frame.tx_start = frame.tx_start or timestamp
+            elif event == EVENT_CODES['TX_PACKET_SENT']:
+                frame.sent = timestamp
+            elif event != EVENT_CODES['TX_CCA_RETRY']:
+                frame.failure = EVENT_NAMES[event]
+
+        elif event == EVENT_CODES['TX_DONE']:
+            frame = open_tx.pop(active_tx, None) if active_tx is not None else None
+            active_tx = None
+            if frame is not None:
+                frame.done = timestamp
+                frame.status = flags
+                tx_frames.append(frame)
+
+        elif event == EVENT_CODES['RX_SYNC']:
+            receiving = RxFrame(timestamp)
+
+        elif receiving is not None and event == EVENT_CODES['RX_FILTER_PASSED']:
+            receiving.filter_passed = timestamp
+
+        elif receiving is not None and event == EVENT_CODES['TXACK_SENT']:
+            receiving.ack_sent = timestamp
+
+        elif receiving is not None and event in RX_ERROR_EVENTS:
+            receiving = None
+
+        elif event == EVENT_CODES['RX_PACKET_RECEIVED']:
+            frame = open_tx.get(active_tx) if active_tx is not None else None
+            if frame is not None and frame.sent is not None and frame.ack is None:
+                # Frame received while waiting for an acknowledgment.
+                frame.ack = timestamp
+            elif receiving is not None:
+                receiving.received = timestamp
+                delivered.append(receiving)
+            receiving = None
+
+        elif event == EVENT_CODES['RECEIVE_DONE'] and delivered:
+            # Broadcast frames are delivered once per interface, only the first one closes the timeline.
+            frame = delivered.pop(0)
+            frame.done = timestamp
+            frame.iid = iid
+            frame.status = flags
+            rx_frames.append(frame)
+
+    return tx_frames, rx_frames
+
+
+def percentile(values, percent):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, (len(ordered) * percent) // 100)]
+
+
+def print_summary(frames, label):
+    metrics = {}
+    for frame in frames:
+        for name, value in frame.metrics().items():
+            if value is not None:
+                metrics.setdefault(name, []).append(value)
+
+    print(f'{label}: {len(frames)} frames')
+    for name, values in metrics.items():
+        print(f'  {name:26s} n={len(values):6d} p50={percentile(values, 50):8d} p90={percentile(values, 90):8d} '
+              f'p99={percentile(values, 99):8d} max={max(values):8d} us')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Analyze an EFR32 radio event trace.')
+    parser.add_argument('--ring', action='store_true', help='the capture is a raw memory dump of sRadioTrace')
+    parser.add_argument('--events', action='store_true', help='print the decoded trace entries')
+    parser.add_argument('--frames', action='store_true', help='print the timeline of every frame')
+    parser.add_argument('--threshold-us',
+                        type=int,
+                        default=0,
+                        help='print the frames with a timing above this value, in microseconds')
+    parser.add_argument('capture', nargs='?', help='binary capture of the trace entries (defaults to stdin)')
+    args = parser.parse_args()
+
+    if args.capture:
+        with open(args.capture, 'rb') as capture_file:
+            data = capture_file.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    entries = read_entries(data, args.ring)
+
+    if args.events:
+        previous = None
+        for timestamp, event, iid, flags in entries:
+            delta = elapsed(previous, timestamp)
+            print(f'[{timestamp:010d}] {"+" + str(delta) if delta is not None else "":>9s} '
+                  f'{EVENT_NAMES.get(event, str(event)):22s} iid={iid} flags=0x{flags:04x}')
+            previous = timestamp
+
+    tx_frames, rx_frames = build_timelines(entries)
+
+    for frame in sorted(tx_frames + rx_frames, key=lambda frame: (frame.done or 0)):
+        slowest = max([value for value in frame.metrics().values() if value is not None], default=0)
+        if args.frames or (args.threshold_us and slowest > args.threshold_us):
+            print(frame.describe())
+
+    print_summary(tx_frames, 'TX')
+    print_summary(rx_frames, 'RX')
+
+
+if __name__ == '__main__':
+    main()
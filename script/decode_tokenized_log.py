@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2025, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Decode tokenized binary log records emitted when SL_OPENTHREAD_TOKENIZED_LOG_ENABLE is set.
+
+The record layout is described in src/src/logging_tokenized.h. Format strings are looked up in the
+ELF file of the firmware which produced the records.
+
+Example:
+    ./script/decode_tokenized_log.py --elf build/ot-rcp.out rtt-capture.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_SYNC = 0xA5
+RECORD_FLAG_TRUNCATED = 0x80
+RECORD_HEADER = struct.Struct('<BBBBII')
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+LOG_LEVELS = ['NONE', 'CRIT', 'WARN', 'NOTE', 'INFO', 'DEBG']
+
+CONVERSION_REGEX = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|L|j|z|t)?([diouxXcspeEfFgGaA%])')
+
+
+class ElfImage:
+    """Read-only view of the allocated sections of a 32-bit little endian ELF file."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as elf_file:
+            self._data = elf_file.read()
+
+        if self._data[:4] != b'\x7fELF' or self._data[4] != 1 or self._data[5] != 1:
+            raise ValueError(f'{path} is not a 32-bit little endian ELF file')
+
+        (section_offset,) = struct.unpack_from('<I', self._data, 0x20)
+        section_size, section_count = struct.unpack_from('<HH', self._data, 0x2E)
+
+        self._sections = []
+        for index in range(section_count):
+            (_, sh_type, sh_flags, sh_addr, sh_offset, sh_size) = struct.unpack_from(
+                '<IIIIII', self._data, section_offset + index * section_size)
+            if sh_type != SHT_NOBITS and sh_flags & SHF_ALLOC and sh_size > 0:
+                self._sections.append((sh_addr, sh_offset, sh_size))
+
+    def read_string(self, address):
+        for sh_addr, sh_offset, sh_size in self._sections:
+            if sh_addr <= address < sh_addr + sh_size:
+                start = sh_offset + address - sh_addr
+                end = self._data.index(b'\0', start, sh_offset + sh_size)
+                return self._data[start:end].decode('utf-8', errors='replace')
+        return None
+
+
+class Payload:
+    """Sequential reader over the argument payload of a record."""
+
+    def __init__(self, data):
+        self._data = data
+        self._offset = 0
+
+    def _take(self, size):
+        if self._offset + size > len(self._data):
+            raise EOFError
+        chunk = self._data[self._offset:self._offset + size]
+        self._offset += size
+        return chunk
+
+    def unpack(self, fmt):
+        return struct.unpack(fmt, self._take(struct.calcsize(fmt)))[0]
+
+    def string(self):
+        size = self._take(1)[0]
+        return self._take(size).decode('utf-8', errors='replace')
+
+
+def format_record(fmt, payload):
+    """Rebuild the text of a record, mirroring the argument encoding of efr32LogTokenizedEncode()."""
+
+    def substitute(match):
+        flags, width, precision, length, conversion = match.groups()
+
+        if conversion == '%':
+            return '%'
+
+        if width == '*':
+            width = str(payload.unpack('<i'))
+        if precision == '*':
+            precision = str(payload.unpack('<i'))
+
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+        if conversion == 's':
+            value = payload.string()
+        elif conversion in 'eEfFgGaA':
+            value = payload.unpack('<d')
+            conversion = 'e' if conversion in 'aA' else conversion
+        elif length in ('ll', 'j'):
+            value = payload.unpack('<q' if conversion in 'di' else '<Q')
+        else:
+            value = payload.unpack('<i' if conversion in 'di' else '<I')
+
+        if conversion == 'p':
+            return '0x' + (spec + 'x') % value
+        if conversion == 'u':
+            conversion = 'd'
+        if conversion == 'c':
+            value = chr(value & 0xFF)
+
+        return (spec + conversion) % value
+
+    try:
+        return CONVERSION_REGEX.sub(substitute, fmt), False
+    except EOFError:
+        return fmt, True
+
+
+def decode_stream(data, elf):
+    """Yields the decoded lines found in a raw capture of tokenized records."""
+
+    offset = 0
+    while offset + RECORD_HEADER.size <= len(data):
+        if data[offset] != RECORD_SYNC:
+            offset += 1
+            continue
+
+        (_, length, level, region, timestamp, address) = RECORD_HEADER.unpack_from(data, offset)
+        end = offset + RECORD_HEADER.size + length
+        fmt = elf.read_string(address)
+
+        if end > len(data) or fmt is None:
+            # Not a record, resynchronize on the next sync byte.
+            offset += 1
+            continue
+
+        text, missing_arguments = format_record(fmt, Payload(data[offset + RECORD_HEADER.size:end]))
+        truncated = (level & RECORD_FLAG_TRUNCATED) or missing_arguments
+        level &= ~RECORD_FLAG_TRUNCATED
+
+        level_name = LOG_LEVELS[level] if level < len(LOG_LEVELS) else str(level)
+        yield f'[{timestamp:010d}] [{level_name}] [{region:2d}] {text.rstrip()}{" <truncated>" if truncated else ""}'
+
+        offset = end
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode tokenized OpenThread log records.')
+    parser.add_argument('--elf', required=True, help='ELF file of the firmware which emitted the records')
+    parser.add_argument('capture', nargs='?', help='raw capture of the log output (defaults to stdin)')
+    args = parser.parse_args()
+
+    elf = ElfImage(args.elf)
+
+    if args.capture:
+        with open(args.capture, 'rb') as capture_file:
+            data = capture_file.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    for line in decode_stream(data, elf):
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2025, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Convert sniffer capture batches recorded with SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE to a pcap file.
+
+The batch and record layouts are described with otPlatRadioExtensionReadSnifferCapture() in
+src/src/sl_radio_extension.h. The input is the batches returned by the device, concatenated in the order they
+were read. The frames are written with the IEEE 802.15.4 TAP link type, which carries the channel, RSSI and LQI
+of every frame to Wireshark.
+
+Example:
+    ./script/sniffer_capture_to_pcap.py --epoch-us 1760000000000000 capture.bin capture.pcap
+"""
+
+import argparse
+import struct
+import sys
+
+BATCH_HEADER = struct.Struct('<HHI')
+RECORD_HEADER = struct.Struct('<BBbBQ')
+
+PCAP_HEADER = struct.Struct('<IHHiIII')
+PCAP_RECORD = struct.Struct('<IIII')
+PCAP_MAGIC = 0xA1B2C3D4
+LINKTYPE_IEEE802_15_4_TAP = 283
+
+TAP_HEADER = struct.Struct('<BBH')
+TAP_TLV_FCS_TYPE = 0
+TAP_TLV_RSS = 1
+TAP_TLV_CHANNEL = 3
+TAP_TLV_LQI = 10
+TAP_FCS_NONE = 0
+
+
+def read_batches(data):
+    """Yields (sequence, dropped, records) for every batch, records being (timestamp, channel, rssi, lqi, frame)."""
+    offset = 0
+    while offset + BATCH_HEADER.size <= len(data):
+        sequence, count, dropped = BATCH_HEADER.unpack_from(data, offset)
+        offset += BATCH_HEADER.size
+        records = []
+        for _ in range(count):
+            length, channel, rssi, lqi, timestamp = RECORD_HEADER.unpack_from(data, offset)
+            offset += RECORD_HEADER.size
+            records.append((timestamp, channel, rssi, lqi, data[offset:offset + length]))
+            offset += length
+        yield sequence, dropped, records
+
+
+def tap_tlv(tlv_type, value):
+    padding = (-len(value)) % 4
+    return struct.pack('<HH', tlv_type, len(value)) + value + bytes(padding)
+
+
+def tap_header(channel, rssi, lqi):
+    tlvs = (tap_tlv(TAP_TLV_FCS_TYPE, bytes([TAP_FCS_NONE])) + tap_tlv(TAP_TLV_RSS, struct.pack('<f', rssi)) +
+            tap_tlv(TAP_TLV_CHANNEL, struct.pack('<HB', channel, 0)) + tap_tlv(TAP_TLV_LQI, bytes([lqi])))
+    return TAP_HEADER.pack(0, 0, TAP_HEADER.size + len(tlvs)) + tlvs
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert EFR32 sniffer capture batches to a pcap file.')
+    parser.add_argument('--epoch-us',
+                        type=int,
+                        default=0,
+                        help='wall clock time of the device time origin, in microseconds since the Unix epoch')
+    parser.add_argument('capture', help='binary capture of the batches')
+    parser.add_argument('output', nargs='?', help='pcap file to write (defaults to stdout)')
+    args = parser.parse_args()
+
+    with open(args.capture, 'rb') as capture_file:
+        data = capture_file.read()
+
+    output = open(args.output, 'wb') if args.output else sys.stdout.buffer
+    output.write(PCAP_HEADER.pack(PCAP_MAGIC, 2, 4, 0, 0, 0xFFFF, LINKTYPE_IEEE802_15_4_TAP))
+
+    frames = 0
+    dropped_total = 0
+    expected_sequence = None
+    for sequence, dropped, records in read_batches(data):
+        if expected_sequence is not None and sequence != expected_sequence:
+            print(f'batch {sequence}: expected batch {expected_sequence}, batches are missing', file=sys.stderr)
+        expected_sequence = (sequence + 1) & 0xFFFF
+
+        if dropped:
+            print(f'batch {sequence}: {dropped} frames dropped on the device', file=sys.stderr)
+        dropped_total += dropped
+
+        for timestamp, channel, rssi, lqi, frame in records:
+            packet = tap_header(channel, rssi, lqi) + frame
+            seconds, microseconds = divmod(args.epoch_us + timestamp, 1000000)
+            output.write(PCAP_RECORD.pack(seconds, microseconds, len(packet), len(packet)))
+            output.write(packet)
+            frames += 1
+
+    if args.output:
+        output.close()
+
+    print(f'{frames} frames written, {dropped_total} dropped on the device', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -35,6 +35,8 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/time.h>
 
 #ifdef SL_COMPONENT_CATALOG_PRESENT
@@ -42,6 +44,7 @@
 #endif // SL_COMPONENT_CATALOG_PRESENT
 
 #include <openthread-core-config.h>
+#include <openthread-system.h>
 #include <utils/code_utils.h>
 #include <openthread/cli.h>
 #include <openthread/platform/alarm-milli.h>
@@ -60,6 +63,7 @@
 #include "platform-efr32.h"
 #include "sl_rail_ieee802154.h"
 
+#include "sl_sleeptimer.h"
 #include "sl_status.h"
 
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
@@ -72,6 +76,8 @@
 #include "sl_rail_util_ant_div.h"
 #endif
 
+#include "logging_plat.h"
+
 #define GPIO_PIN_BITMASK 0xFFFFUL
 #define GPIO_PORT_BITMASK (0xFFFFUL << 16)
 #define GET_GPIO_PIN(x) (x & GPIO_PIN_BITMASK)
@@ -115,6 +121,600 @@ static void appendErrorResult(otError aError)
     }
 }
 
+// *****************************************************************************
+// Packet error rate test
+// *****************************************************************************
+
+// A PER frame is a data frame from short address 0x0000 with PAN ID compression, to the broadcast address or, for
+// the benchmark, to a unicast address with an ACK request. Its payload is the magic, the index of the frame and the
+// number of frames of the test, followed by a fill pattern up to the requested length.
+#define DIAG_PER_FCF_LOW 0x41
+#define DIAG_PER_FCF_HIGH 0x88
+#define DIAG_PER_FCF_ACK_REQUEST 0x20
+#define DIAG_PER_DSN_OFFSET 2
+#define DIAG_PER_DST_ADDR_OFFSET 5
+#define DIAG_PER_MAGIC_OFFSET 9
+#define DIAG_PER_INDEX_OFFSET 13
+#define DIAG_PER_COUNT_OFFSET 17
+#define DIAG_PER_HEADER_LENGTH 21
+#define DIAG_PER_FCS_SIZE 2
+#define DIAG_PER_MIN_LENGTH (DIAG_PER_HEADER_LENGTH + DIAG_PER_FCS_SIZE)
+#define DIAG_PER_DEFAULT_LENGTH 64
+
+#define DIAG_PER_LQI_BIN_COUNT 8
+#define DIAG_PER_LQI_BIN_WIDTH (256 / DIAG_PER_LQI_BIN_COUNT)
+
+static const uint8_t sPerMagic[] = {'E', 'P', 'E', 'R'};
+
+typedef struct DiagPerTx
+{
+    otInstance *mInstance;
+    bool        mActive;
+    bool        mBench; // Started by `diag bench tx`, reported by benchTxReport().
+    uint8_t     mChannel;
+    uint8_t     mLength;
+    uint32_t    mCount;     // Frames to send.
+    uint32_t    mInterval;  // Interval between two frames in milliseconds, 0 to send them back to back.
+    uint32_t    mStartTime; // Time the first frame was sent at, in milliseconds.
+    uint32_t    mNextIndex; // Index of the next frame to send.
+    uint32_t    mSent;
+    uint32_t    mFailed;
+    uint32_t    mBusy; // Attempts deferred because the radio was busy.
+    uint8_t     mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+} DiagPerTx;
+
+typedef struct DiagPerRx
+{
+    bool     mActive;
+    bool     mReported;   // The summary was printed when the last frame of the test was received.
+    uint32_t mExpected;   // Frames of the test, as announced by the received frames.
+    uint32_t mReceived;   // PER frames received, duplicates included.
+    uint32_t mDuplicates; // Frames received with the index of the previous frame.
+    uint32_t mOutOfOrder; // Frames received with an index lower than the one of the previous frame.
+    uint32_t mLastIndex;
+    uint32_t mCrcErrors; // CRC errors counted when the test was stopped.
+    int32_t  mRssiSum;
+    int8_t   mRssiMin;
+    int8_t   mRssiMax;
+    uint32_t mRssiHistogram[EFR32_RSSI_HISTOGRAM_BIN_COUNT];
+    uint32_t mLqiHistogram[DIAG_PER_LQI_BIN_COUNT];
+} DiagPerRx;
+
+typedef struct DiagBenchRx
+{
+    bool     mActive;
+    uint32_t mStartTime; // In milliseconds.
+    uint32_t mFrames;    // Frames delivered by the radio since the start.
+} DiagBenchRx;
+
+static DiagPerTx   sPerTx;
+static DiagPerRx   sPerRx;
+static DiagBenchRx sBenchRx;
+
+// The frames are paced by a timer of their own, the diag alarm is left to `diag repeat`.
+static sl_sleeptimer_timer_handle_t sPerTxTimer;
+static volatile bool                sPerTxTimerFired;
+
+// Set while `diag stream` or `diag cw` holds the radio.
+static bool sTxStreamActive;
+
+static const char *const sBenchPathNames[EFR32_RADIO_BENCH_PATH_COUNT] = {
+    "rail callback", "rx queue", "rx delivery", "ack", "tx start", "tx done",
+};
+
+static void perPut32(uint8_t *aBuffer, uint32_t aValue)
+{
+    aBuffer[0] = (uint8_t)aValue;
+    aBuffer[1] = (uint8_t)(aValue >> 8);
+    aBuffer[2] = (uint8_t)(aValue >> 16);
+    aBuffer[3] = (uint8_t)(aValue >> 24);
+}
+
+static uint32_t perGet32(const uint8_t *aBuffer)
+{
+    return (uint32_t)aBuffer[0] | ((uint32_t)aBuffer[1] << 8) | ((uint32_t)aBuffer[2] << 16) |
+           ((uint32_t)aBuffer[3] << 24);
+}
+
+static otError parseUint32(const char *aString, uint32_t *aValue)
+{
+    otError       error = OT_ERROR_NONE;
+    char         *end;
+    unsigned long value = strtoul(aString, &end, 0);
+
+    VerifyOrExit(*aString != '\0' && *end == '\0', error = OT_ERROR_INVALID_ARGS);
+    *aValue = (uint32_t)value;
+
+exit:
+    return error;
+}
+
+static void perTxReport(void)
+{
+    diagOutput("per tx: sent %lu, failed %lu, busy %lu, %lu of %lu frames, %lu ms\r\n",
+               (unsigned long)sPerTx.mSent,
+               (unsigned long)sPerTx.mFailed,
+               (unsigned long)sPerTx.mBusy,
+               (unsigned long)sPerTx.mNextIndex,
+               (unsigned long)sPerTx.mCount,
+               (unsigned long)(otPlatAlarmMilliGetNow() - sPerTx.mStartTime));
+}
+
+static uint32_t benchFramesPerSecond(uint32_t aFrames, uint32_t aElapsed)
+{
+    return (aElapsed != 0) ? (uint32_t)(((uint64_t)aFrames * 1000) / aElapsed) : 0;
+}
+
+// Prints the radio paths accounted since the start of the benchmark. The cost of a frame is the sum of the cycles
+// of the paths in aPathMask, divided by aFrames.
+static void benchReportPaths(uint32_t aFrames, uint32_t aPathMask)
+{
+    efr32RadioBenchCounters counters;
+    uint64_t                cycles = 0;
+
+    VerifyOrExit(efr32RadioGetBenchCounters(&counters) == OT_ERROR_NONE);
+
+    for (uint8_t i = 0; i < EFR32_RADIO_BENCH_PATH_COUNT; i++)
+    {
+        const efr32RadioBenchPath *path = &counters.mPaths[i];
+
+        if (path->mCount != 0)
+        {
+            diagOutput("%s: count %lu, avg %lu cycles, max %lu cycles\r\n",
+                       sBenchPathNames[i],
+                       (unsigned long)path->mCount,
+                       (unsigned long)(path->mCycles / path->mCount),
+                       (unsigned long)path->mMaxCycles);
+        }
+
+        if (aPathMask & (1U << i))
+        {
+            cycles += path->mCycles;
+        }
+    }
+
+    if (aFrames != 0)
+    {
+        diagOutput("cycles/frame %lu\r\n", (unsigned long)(cycles / aFrames));
+    }
+
+    diagOutput("rx dropped %lu, rx overflows %lu\r\n",
+               (unsigned long)counters.mRxDropped,
+               (unsigned long)counters.mRxOverflows);
+
+exit:
+    return;
+}
+
+static void benchTxReport(void)
+{
+    uint32_t elapsed = otPlatAlarmMilliGetNow() - sPerTx.mStartTime;
+
+    diagOutput("bench tx: sent %lu, failed %lu, busy %lu in %lu ms, %lu frames/s\r\n",
+               (unsigned long)sPerTx.mSent,
+               (unsigned long)sPerTx.mFailed,
+               (unsigned long)sPerTx.mBusy,
+               (unsigned long)elapsed,
+               (unsigned long)benchFramesPerSecond(sPerTx.mSent, elapsed));
+    benchReportPaths(sPerTx.mSent,
+                     (1U << EFR32_RADIO_BENCH_RAIL_CALLBACK) | (1U << EFR32_RADIO_BENCH_TX_START)
+                         | (1U << EFR32_RADIO_BENCH_TX_DONE));
+}
+
+static void benchRxReport(void)
+{
+    uint32_t elapsed = otPlatAlarmMilliGetNow() - sBenchRx.mStartTime;
+
+    diagOutput("bench rx: received %lu in %lu ms, %lu frames/s\r\n",
+               (unsigned long)sBenchRx.mFrames,
+               (unsigned long)elapsed,
+               (unsigned long)benchFramesPerSecond(sBenchRx.mFrames, elapsed));
+    benchReportPaths(sBenchRx.mFrames,
+                     (1U << EFR32_RADIO_BENCH_RAIL_CALLBACK) | (1U << EFR32_RADIO_BENCH_RX_DELIVERY));
+}
+
+static void perTxFinish(void)
+{
+    sPerTx.mActive = false;
+
+    if (sPerTx.mBench)
+    {
+        benchTxReport();
+    }
+    else
+    {
+        perTxReport();
+    }
+}
+
+static void perTxTimerCallback(sl_sleeptimer_timer_handle_t *aHandle, void *aData)
+{
+    OT_UNUSED_VARIABLE(aHandle);
+    OT_UNUSED_VARIABLE(aData);
+
+    sPerTxTimerFired = true;
+    otSysEventSignalPending();
+}
+
+static void perTxStopTimer(void)
+{
+    (void)sl_sleeptimer_stop_timer(&sPerTxTimer);
+    sPerTxTimerFired = false;
+}
+
+static void perTxStartTimer(uint32_t aDelay)
+{
+    perTxStopTimer();
+    (void)sl_sleeptimer_start_timer_ms(&sPerTxTimer, aDelay, perTxTimerCallback, NULL, 0, 0);
+}
+
+// Arms the timer for the next frame, which is sent by efr32DiagProcess().
+static void perTxArm(void)
+{
+    // The frames are paced from the start of the test, so that late frames do not delay the next ones.
+    int32_t delay = (int32_t)(sPerTx.mStartTime + sPerTx.mNextIndex * sPerTx.mInterval - otPlatAlarmMilliGetNow());
+
+    perTxStartTimer((delay > 0) ? (uint32_t)delay : 0);
+}
+
+static void perTxSendNext(void)
+{
+    otError error;
+
+    sPerTx.mPsdu[DIAG_PER_DSN_OFFSET] = (uint8_t)sPerTx.mNextIndex;
+    perPut32(&sPerTx.mPsdu[DIAG_PER_INDEX_OFFSET], sPerTx.mNextIndex);
+
+    error = efr32RadioTransmitDiagFrame(sPerTx.mInstance, sPerTx.mPsdu, sPerTx.mLength, sPerTx.mChannel, sTxPower);
+
+    if (error == OT_ERROR_BUSY)
+    {
+        sPerTx.mBusy++;
+        perTxStartTimer(1);
+        ExitNow();
+    }
+
+    sPerTx.mNextIndex++;
+
+    // Otherwise the frame is accounted for in efr32DiagTxDone().
+    VerifyOrExit(error != OT_ERROR_NONE);
+    sPerTx.mFailed++;
+
+    if (sPerTx.mNextIndex >= sPerTx.mCount)
+    {
+        perTxFinish();
+    }
+    else
+    {
+        perTxArm();
+    }
+
+exit:
+    return;
+}
+
+// Prepares a test, started by perTxSendNext(). Frames to a unicast aDestination request an ACK.
+static void perTxPrepare(otInstance *aInstance,
+                         uint32_t    aCount,
+                         uint32_t    aInterval,
+                         uint8_t     aChannel,
+                         uint8_t     aLength,
+                         uint16_t    aDestination)
+{
+    uint8_t *psdu = sPerTx.mPsdu;
+
+    memset(&sPerTx, 0, sizeof(sPerTx));
+    sPerTx.mInstance = aInstance;
+    sPerTx.mActive   = true;
+    sPerTx.mChannel  = aChannel;
+    sPerTx.mLength   = aLength;
+    sPerTx.mCount    = aCount;
+    sPerTx.mInterval = aInterval;
+
+    psdu[0] = DIAG_PER_FCF_LOW | ((aDestination != 0xffff) ? DIAG_PER_FCF_ACK_REQUEST : 0);
+    psdu[1] = DIAG_PER_FCF_HIGH;
+    memset(&psdu[3], 0xff, 2); // Destination PAN ID.
+    psdu[DIAG_PER_DST_ADDR_OFFSET]     = (uint8_t)aDestination;
+    psdu[DIAG_PER_DST_ADDR_OFFSET + 1] = (uint8_t)(aDestination >> 8);
+    memset(&psdu[7], 0x00, 2); // Source address.
+    memcpy(&psdu[DIAG_PER_MAGIC_OFFSET], sPerMagic, sizeof(sPerMagic));
+    perPut32(&psdu[DIAG_PER_COUNT_OFFSET], aCount);
+
+    for (uint8_t i = DIAG_PER_HEADER_LENGTH; i < aLength - DIAG_PER_FCS_SIZE; i++)
+    {
+        psdu[i] = i;
+    }
+
+    sPerTx.mStartTime = otPlatAlarmMilliGetNow();
+}
+
+static uint32_t perRxCrcErrors(void)
+{
+    return sPerRx.mActive ? efr32RadioGetRxFrameErrorCount() : sPerRx.mCrcErrors;
+}
+
+static void perRxReport(void)
+{
+    uint32_t unique   = sPerRx.mReceived - sPerRx.mDuplicates;
+    uint32_t expected = (sPerRx.mExpected > unique) ? sPerRx.mExpected : unique;
+    uint32_t lost     = expected - unique;
+    uint32_t per      = (expected != 0) ? (uint32_t)(((uint64_t)lost * 10000) / expected) : 0;
+
+    diagOutput("per rx: received %lu of %lu, lost %lu, duplicates %lu, out of order %lu, crc errors %lu, "
+               "per %lu.%02lu%%\r\n",
+               (unsigned long)unique,
+               (unsigned long)expected,
+               (unsigned long)lost,
+               (unsigned long)sPerRx.mDuplicates,
+               (unsigned long)sPerRx.mOutOfOrder,
+               (unsigned long)perRxCrcErrors(),
+               (unsigned long)(per / 100),
+               (unsigned long)(per % 100));
+
+    VerifyOrExit(sPerRx.mReceived != 0);
+
+    diagOutput("rssi: min %d, avg %d, max %d\r\n",
+               sPerRx.mRssiMin,
+               (int)(sPerRx.mRssiSum / (int32_t)sPerRx.mReceived),
+               sPerRx.mRssiMax);
+
+    for (uint16_t i = 0; i < EFR32_RSSI_HISTOGRAM_BIN_COUNT; i++)
+    {
+        int lower = -128 + i * EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM;
+
+        if (sPerRx.mRssiHistogram[i] != 0)
+        {
+            diagOutput("rssi [%d, %d]: %lu\r\n",
+                       lower,
+                       lower + EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM - 1,
+                       (unsigned long)sPerRx.mRssiHistogram[i]);
+        }
+    }
+
+    for (uint16_t i = 0; i < DIAG_PER_LQI_BIN_COUNT; i++)
+    {
+        if (sPerRx.mLqiHistogram[i] != 0)
+        {
+            diagOutput("lqi [%u, %u]: %lu\r\n",
+                       i * DIAG_PER_LQI_BIN_WIDTH,
+                       (i + 1) * DIAG_PER_LQI_BIN_WIDTH - 1,
+                       (unsigned long)sPerRx.mLqiHistogram[i]);
+        }
+    }
+
+exit:
+    return;
+}
+
+static void perRxProcess(const otRadioFrame *aFrame)
+{
+    const uint8_t *psdu = aFrame->mPsdu;
+    int8_t         rssi = aFrame->mInfo.mRxInfo.mRssi;
+    uint8_t        lqi  = aFrame->mInfo.mRxInfo.mLqi;
+    uint32_t       index;
+
+    VerifyOrExit(aFrame->mLength >= DIAG_PER_MIN_LENGTH);
+    VerifyOrExit((psdu[0] & ~DIAG_PER_FCF_ACK_REQUEST) == DIAG_PER_FCF_LOW && psdu[1] == DIAG_PER_FCF_HIGH);
+    VerifyOrExit(memcmp(&psdu[DIAG_PER_MAGIC_OFFSET], sPerMagic, sizeof(sPerMagic)) == 0);
+
+    index            = perGet32(&psdu[DIAG_PER_INDEX_OFFSET]);
+    sPerRx.mExpected = perGet32(&psdu[DIAG_PER_COUNT_OFFSET]);
+
+    if (sPerRx.mReceived != 0 && index == sPerRx.mLastIndex)
+    {
+        sPerRx.mDuplicates++;
+    }
+    else if (sPerRx.mReceived != 0 && index < sPerRx.mLastIndex)
+    {
+        sPerRx.mOutOfOrder++;
+    }
+
+    if (sPerRx.mReceived == 0 || rssi < sPerRx.mRssiMin)
+    {
+        sPerRx.mRssiMin = rssi;
+    }
+
+    if (sPerRx.mReceived == 0 || rssi > sPerRx.mRssiMax)
+    {
+        sPerRx.mRssiMax = rssi;
+    }
+
+    sPerRx.mReceived++;
+    sPerRx.mLastIndex = index;
+    sPerRx.mRssiSum += rssi;
+    sPerRx.mRssiHistogram[(rssi + 128) / EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM]++;
+    sPerRx.mLqiHistogram[lqi / DIAG_PER_LQI_BIN_WIDTH]++;
+
+    if (!sPerRx.mReported && index + 1 == sPerRx.mExpected)
+    {
+        sPerRx.mReported = true;
+        perRxReport();
+    }
+
+exit:
+    return;
+}
+
+static otError processPerTx(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    otError  error  = OT_ERROR_NONE;
+    uint32_t length = DIAG_PER_DEFAULT_LENGTH;
+    uint32_t count;
+    uint32_t interval;
+    uint16_t channel;
+
+    if (aArgsLength == 0)
+    {
+        perTxReport();
+    }
+    else if (strcmp(aArgs[0], "stop") == 0)
+    {
+        VerifyOrExit(sPerTx.mActive, error = OT_ERROR_INVALID_STATE);
+        perTxStopTimer();
+        perTxFinish();
+    }
+    else
+    {
+        VerifyOrExit(!sPerTx.mActive && !sTxStreamActive, error = OT_ERROR_BUSY);
+        VerifyOrExit(aArgsLength >= 2, error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = parseUint32(aArgs[0], &count));
+        SuccessOrExit(error = parseUint32(aArgs[1], &interval));
+
+        if (aArgsLength > 2)
+        {
+            SuccessOrExit(error = parseUint32(aArgs[2], &length));
+        }
+
+        VerifyOrExit(count != 0, error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(length >= DIAG_PER_MIN_LENGTH && length <= OT_RADIO_FRAME_MAX_SIZE,
+                     error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(sl_rail_get_channel(gRailHandle, &channel) == SL_RAIL_STATUS_NO_ERROR,
+                     error = OT_ERROR_FAILED);
+
+        otLogInfoPlat("Diag PER tx %lu frames every %lu ms", (unsigned long)count, (unsigned long)interval);
+        perTxPrepare(aInstance, count, interval, (uint8_t)channel, (uint8_t)length, 0xffff);
+        perTxSendNext();
+    }
+
+exit:
+    return error;
+}
+
+static otError processPerRx(uint8_t aArgsLength, char *aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aArgsLength == 0)
+    {
+        perRxReport();
+    }
+    else if (strcmp(aArgs[0], "start") == 0)
+    {
+        memset(&sPerRx, 0, sizeof(sPerRx));
+        efr32RadioSetRxFrameErrorCount(true);
+        sPerRx.mActive = true;
+    }
+    else if (strcmp(aArgs[0], "stop") == 0)
+    {
+        VerifyOrExit(sPerRx.mActive, error = OT_ERROR_INVALID_STATE);
+        sPerRx.mCrcErrors = efr32RadioGetRxFrameErrorCount();
+        sPerRx.mActive    = false;
+        efr32RadioSetRxFrameErrorCount(false);
+        perRxReport();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+
+static otError processBenchTx(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    otError  error       = OT_ERROR_NONE;
+    uint32_t length      = DIAG_PER_DEFAULT_LENGTH;
+    uint32_t destination = 0xffff;
+    uint32_t count;
+    uint16_t channel;
+
+    VerifyOrExit(!sPerTx.mActive && !sTxStreamActive, error = OT_ERROR_BUSY);
+    VerifyOrExit(aArgsLength >= 1, error = OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = parseUint32(aArgs[0], &count));
+
+    if (aArgsLength > 1)
+    {
+        SuccessOrExit(error = parseUint32(aArgs[1], &length));
+    }
+
+    if (aArgsLength > 2)
+    {
+        SuccessOrExit(error = parseUint32(aArgs[2], &destination));
+    }
+
+    VerifyOrExit(count != 0 && destination <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(length >= DIAG_PER_MIN_LENGTH && length <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(sl_rail_get_channel(gRailHandle, &channel) == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
+
+    otLogInfoPlat("Diag bench tx %lu frames", (unsigned long)count);
+    IgnoreError(efr32RadioResetBenchCounters());
+    perTxPrepare(aInstance, count, 0, (uint8_t)channel, (uint8_t)length, (uint16_t)destination);
+    sPerTx.mBench = true;
+    perTxSendNext();
+
+exit:
+    return error;
+}
+
+static otError processBenchRx(uint8_t aArgsLength, char *aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aArgsLength > 0, error = OT_ERROR_INVALID_ARGS);
+
+    if (strcmp(aArgs[0], "start") == 0)
+    {
+        IgnoreError(efr32RadioResetBenchCounters());
+        sBenchRx.mStartTime = otPlatAlarmMilliGetNow();
+        sBenchRx.mFrames    = 0;
+        sBenchRx.mActive    = true;
+    }
+    else if (strcmp(aArgs[0], "stop") == 0)
+    {
+        VerifyOrExit(sBenchRx.mActive, error = OT_ERROR_INVALID_STATE);
+        sBenchRx.mActive = false;
+        benchRxReport();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+
+// Measures the cost of a platform log call in the calling context, as seen by the code logging. With tokenized
+// logging the call only encodes the record, without it the call formats the text first.
+static otError processBenchLog(uint8_t aArgsLength, char *aArgs[])
+{
+    otError  error     = OT_ERROR_NONE;
+    uint64_t cycles    = 0;
+    uint32_t maxCycles = 0;
+    uint32_t count;
+
+    VerifyOrExit(aArgsLength == 1, error = OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = parseUint32(aArgs[0], &count));
+    VerifyOrExit(count != 0, error = OT_ERROR_INVALID_ARGS);
+
+    // The DWT cycle counter is started along with the radio benchmark counters.
+    SuccessOrExit(error = efr32RadioResetBenchCounters());
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t start = DWT->CYCCNT;
+        uint32_t elapsed;
+
+        // A typical platform log line, a few integers and a short string.
+        otLogCritPlat("Diag bench log %lu, channel %u, rssi %d, %s", (unsigned long)i, 15U, -60, "tx done");
+        elapsed = DWT->CYCCNT - start;
+        cycles += elapsed;
+
+        if (elapsed > maxCycles)
+        {
+            maxCycles = elapsed;
+        }
+    }
+
+    diagOutput("bench log: %lu calls, avg %lu cycles, max %lu cycles\r\n",
+               (unsigned long)count,
+               (unsigned long)(cycles / count),
+               (unsigned long)maxCycles);
+
+exit:
+    return error;
+}
+
 // *****************************************************************************
 // CLI functions
 // *****************************************************************************
@@ -164,12 +764,64 @@ exit:
     return error;
 }
 
+static otError processPer(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    otError error = OT_ERROR_INVALID_ARGS;
+
+    VerifyOrExit(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(aArgsLength > 0, error = OT_ERROR_INVALID_ARGS);
+
+    if (strcmp(aArgs[0], "tx") == 0)
+    {
+        error = processPerTx(aInstance, aArgsLength - 1, &aArgs[1]);
+    }
+    else if (strcmp(aArgs[0], "rx") == 0)
+    {
+        error = processPerRx(aArgsLength - 1, &aArgs[1]);
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processBench(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    otError error = OT_ERROR_INVALID_ARGS;
+
+    VerifyOrExit(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        benchReportPaths(0, 0);
+        error = OT_ERROR_NONE;
+    }
+    else if (strcmp(aArgs[0], "tx") == 0)
+    {
+        error = processBenchTx(aInstance, aArgsLength - 1, &aArgs[1]);
+    }
+    else if (strcmp(aArgs[0], "rx") == 0)
+    {
+        error = processBenchRx(aArgsLength - 1, &aArgs[1]);
+    }
+    else if (strcmp(aArgs[0], "log") == 0)
+    {
+        error = processBenchLog(aArgsLength - 1, &aArgs[1]);
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
 // *****************************************************************************
 // Add more platform specific diagnostic's CLI features here.
 // *****************************************************************************
 const struct PlatformDiagCommand sCommands[] = {
     {"addr-match", &processAddressMatch},
     {"auto-ack", &processAutoAck},
+    {"per", &processPer},
+    {"bench", &processBench},
 };
 
 otError otPlatDiagProcess(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
@@ -216,6 +868,8 @@ static sl_rail_status_t startTxStream(sl_rail_stream_mode_t aMode)
     uint16_t         txChannel;
     sl_rail_status_t status;
 
+    // The PER test does not share the radio with a stream.
+    VerifyOrExit(!sPerTx.mActive, status = SL_RAIL_STATUS_INVALID_STATE);
     SuccessOrExit(status = sl_rail_get_channel(gRailHandle, &txChannel));
     sl_rail_tx_options_t txOptions = SL_RAIL_TX_OPTIONS_DEFAULT;
 
@@ -230,7 +884,8 @@ static sl_rail_status_t startTxStream(sl_rail_stream_mode_t aMode)
                           : SL_RAIL_TX_OPTION_ANTENNA_1);
     }
 #endif
-    status = sl_rail_start_tx_stream(gRailHandle, txChannel, aMode, txOptions);
+    status          = sl_rail_start_tx_stream(gRailHandle, txChannel, aMode, txOptions);
+    sTxStreamActive = (status == SL_RAIL_STATUS_NO_ERROR);
 exit:
     return status;
 }
@@ -244,6 +899,7 @@ static sl_rail_status_t stopTxStream(void)
     };
 
     SuccessOrExit(status = sl_rail_stop_tx_stream(gRailHandle));
+    sTxStreamActive = false;
     // Since start transmit stream turn off the radio state,
     // call the sl_rail_start_rx to turn on radio
     IgnoreError(sl_rail_get_channel(gRailHandle, &currentChannel));
@@ -337,14 +993,28 @@ void otPlatDiagTxPowerSet(int8_t aTxPower)
     // Multiply by 10 because aPower is supposed be in units dBm
     status = sl_rail_set_tx_power_dbm(gRailHandle, ((sl_rail_tx_power_t)aTxPower) * 10);
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
+    sli_invalidate_tx_power_in_rail();
     sTxPower = aTxPower;
 }
 
 void otPlatDiagRadioReceived(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
 {
     OT_UNUSED_VARIABLE(aInstance);
-    OT_UNUSED_VARIABLE(aFrame);
-    OT_UNUSED_VARIABLE(aError);
+
+    VerifyOrExit(aError == OT_ERROR_NONE);
+
+    if (sPerRx.mActive)
+    {
+        perRxProcess(aFrame);
+    }
+
+    if (sBenchRx.mActive)
+    {
+        sBenchRx.mFrames++;
+    }
+
+exit:
+    return;
 }
 
 void otPlatDiagAlarmCallback(otInstance *aInstance)
@@ -352,6 +1022,50 @@ void otPlatDiagAlarmCallback(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
 }
 
+void efr32DiagProcess(void)
+{
+    VerifyOrExit(sPerTxTimerFired);
+    sPerTxTimerFired = false;
+
+    if (sPerTx.mActive)
+    {
+        perTxSendNext();
+    }
+
+exit:
+    return;
+}
+
+void efr32DiagTxDone(otError aError)
+{
+    VerifyOrExit(sPerTx.mActive);
+
+    if (aError == OT_ERROR_NONE)
+    {
+        sPerTx.mSent++;
+    }
+    else
+    {
+        sPerTx.mFailed++;
+    }
+
+    if (sPerTx.mNextIndex >= sPerTx.mCount)
+    {
+        perTxFinish();
+    }
+    else if (sPerTx.mInterval == 0)
+    {
+        perTxSendNext();
+    }
+    else
+    {
+        perTxArm();
+    }
+
+exit:
+    return;
+}
+
 static otError getGpioPortAndPin(uint32_t aGpio, uint16_t *aPort, uint16_t *aPin)
 {
     otError error = OT_ERROR_NONE;
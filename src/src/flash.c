@@ -113,6 +113,7 @@ void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset
 #include <openthread/platform/settings.h>
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "logging_plat.h"
 
 #define NVM3KEY_DOMAIN_OPENTHREAD 0x20000U
 #define NUM_INDEXED_SETTINGS \
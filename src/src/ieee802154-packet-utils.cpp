@@ -34,6 +34,7 @@
 
 #include "ieee802154-packet-utils.hpp"
 #include "em_device.h"
+#include "ieee802154mac.h"
 #include "sl_core.h"
 #include "sl_packet_utils.h"
 #if defined(RADIOAES_PRESENT)
@@ -43,6 +44,7 @@
 #endif
 
 #include <assert.h>
+#include <string.h>
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
@@ -329,18 +331,192 @@ exit:
 #endif // OPENTHREAD_RADIO && (OPENTHREAD_CONFIG_THREAD_VERSION < OT_THREAD_VERSION_1_2))
 }
 
+// Length of an address for the addressing mode at bits 0..1 of aMode, 0xFF for the reserved mode.
+static uint8_t efr32AddressLength(uint16_t aMode)
+{
+    static const uint8_t kAddressLengths[] = {0, 0xFF, sizeof(otShortAddress), sizeof(otExtAddress)};
+
+    return kAddressLengths[aMode & 0x3];
+}
+
+// Length of the MIC for the security level at bits 0..2 of the security control field.
+static uint8_t efr32MicLength(uint8_t aSecurityControl)
+{
+    // Levels 4 to 7 add encryption to levels 0 to 3, with the same MIC lengths.
+    static const uint8_t kMicLengths[] = {0, 4, 8, 16, 0, 4, 8, 16};
+
+    return kMicLengths[aSecurityControl & 0x7];
+}
+
+bool efr32ParseMacFrame(const otRadioFrame *aFrame, efr32MacFrameInfo *aInfo)
+{
+    const uint8_t *psdu   = aFrame->mPsdu;
+    uint16_t       length = aFrame->mLength;
+    uint16_t       index  = IEEE802154_DSN_OFFSET;
+    uint16_t       footerLength;
+    uint16_t       fcf;
+    bool           isVersion2015;
+    bool           panIdCompression;
+    bool           dstPanIdPresent = false;
+    bool           srcPanIdPresent = false;
+    bool           parsed          = false;
+
+    memset(aInfo, 0, sizeof(*aInfo));
+
+    VerifyOrExit(length >= IEEE802154_MIN_LENGTH && length <= IEEE802154_MAX_LENGTH);
+
+    fcf              = static_cast<uint16_t>(psdu[IEEE802154_FCF_OFFSET] | (psdu[IEEE802154_FCF_OFFSET + 1] << 8));
+    isVersion2015    = ((fcf & IEEE802154_FRAME_VERSION_MASK) == IEEE802154_FRAME_VERSION_2015);
+    panIdCompression = ((fcf & IEEE802154_FRAME_FLAG_PANID_COMPRESSION) != 0);
+    footerLength     = IEEE802154_FCS_LENGTH;
+    aInfo->mFcf      = fcf;
+
+    VerifyOrExit((fcf & IEEE802154_FRAME_TYPE_MASK) != IEEE802154_FRAME_TYPE_MULTIPURPOSE);
+
+    aInfo->mDstAddrLength = efr32AddressLength(fcf >> 10);
+    aInfo->mSrcAddrLength = efr32AddressLength(fcf >> 14);
+    VerifyOrExit(aInfo->mDstAddrLength != 0xFF && aInfo->mSrcAddrLength != 0xFF);
+
+    if (!isVersion2015 || !(fcf & IEEE802154_FRAME_FLAG_SEQ_SUPPRESSION))
+    {
+        index++;
+    }
+
+    // PAN ID presence, see IEEE 802.15.4-2015 table 7-2 for 2015 frames.
+    if (!isVersion2015)
+    {
+        dstPanIdPresent = (aInfo->mDstAddrLength != 0);
+        srcPanIdPresent = (aInfo->mSrcAddrLength != 0) && !panIdCompression;
+    }
+    else if (aInfo->mDstAddrLength == 0 && aInfo->mSrcAddrLength == 0)
+    {
+        dstPanIdPresent = panIdCompression;
+    }
+    else if (aInfo->mSrcAddrLength == 0)
+    {
+        dstPanIdPresent = !panIdCompression;
+    }
+    else if (aInfo->mDstAddrLength == 0)
+    {
+        srcPanIdPresent = !panIdCompression;
+    }
+    else if (aInfo->mDstAddrLength == sizeof(otExtAddress) && aInfo->mSrcAddrLength == sizeof(otExtAddress))
+    {
+        dstPanIdPresent = !panIdCompression;
+    }
+    else
+    {
+        dstPanIdPresent = true;
+        srcPanIdPresent = !panIdCompression;
+    }
+
+    if (dstPanIdPresent)
+    {
+        aInfo->mDstPanIdOffset = static_cast<uint8_t>(index);
+        index += sizeof(otPanId);
+    }
+
+    if (aInfo->mDstAddrLength != 0)
+    {
+        aInfo->mDstAddrOffset = static_cast<uint8_t>(index);
+        index += aInfo->mDstAddrLength;
+    }
+
+    if (srcPanIdPresent)
+    {
+        aInfo->mSrcPanIdOffset = static_cast<uint8_t>(index);
+        index += sizeof(otPanId);
+    }
+
+    if (aInfo->mSrcAddrLength != 0)
+    {
+        aInfo->mSrcAddrOffset = static_cast<uint8_t>(index);
+        index += aInfo->mSrcAddrLength;
+    }
+
+    if (fcf & IEEE802154_FRAME_FLAG_SECURITY_ENABLED)
+    {
+        uint8_t securityControl;
+
+        VerifyOrExit(index + footerLength < length);
+
+        securityControl        = psdu[index];
+        aInfo->mSecurityOffset = static_cast<uint8_t>(index);
+        footerLength += efr32MicLength(securityControl);
+        index += sizeof(securityControl);
+
+        // Frame counter, which 2015 frames may suppress.
+        if (!isVersion2015 || !(securityControl & 0x20))
+        {
+            index += sizeof(uint32_t);
+        }
+
+        // Key identifier: key source of 0, 4 or 8 bytes, followed by the key index.
+        switch (securityControl & IEEE802154_KEYID_MODE_MASK)
+        {
+        case IEEE802154_KEYID_MODE_1:
+            index += 1;
+            break;
+        case IEEE802154_KEYID_MODE_2:
+            index += 1 + IEEE802154_KEYID_MODE_2_SIZE;
+            break;
+        case IEEE802154_KEYID_MODE_3:
+            index += 1 + IEEE802154_KEYID_MODE_3_SIZE;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (isVersion2015 && (fcf & IEEE802154_FRAME_FLAG_IE_LIST_PRESENT))
+    {
+        aInfo->mIeOffset = static_cast<uint8_t>(index);
+
+        while (index + sizeof(uint16_t) + footerLength <= length)
+        {
+            uint16_t ie = static_cast<uint16_t>(psdu[index] | (psdu[index + 1] << 8));
+            uint8_t  id = static_cast<uint8_t>((ie & IEEE802154_FRAME_HEADER_INFO_ELEMENT_ID_MASK)
+                                              >> IEEE802154_FRAME_HEADER_INFO_ELEMENT_ID_SHIFT);
+
+            index += sizeof(uint16_t) + (ie & IEEE802154_FRAME_HEADER_INFO_ELEMENT_LENGTH_MASK);
+
+            if (id == IEEE802154_FRAME_HEADER_TERMINATION_ID_1 || id == IEEE802154_FRAME_HEADER_TERMINATION_ID_2)
+            {
+                break;
+            }
+        }
+    }
+
+    if (!isVersion2015 && (fcf & IEEE802154_FRAME_TYPE_MASK) == IEEE802154_FRAME_TYPE_COMMAND)
+    {
+        // Command identifier
+        index += 1;
+    }
+
+    VerifyOrExit(index + footerLength <= length);
+
+    aInfo->mPayloadOffset = static_cast<uint8_t>(index);
+    aInfo->mPayloadLength = static_cast<uint8_t>(length - footerLength - index);
+    aInfo->mFooterLength  = static_cast<uint8_t>(footerLength);
+    parsed                = true;
+
+exit:
+    return parsed;
+}
+
 bool efr32IsFramePending(otRadioFrame *aFrame)
 {
-    return static_cast<Mac::RxFrame *>(aFrame)->GetFramePending();
+    return (aFrame->mPsdu[IEEE802154_FCF_OFFSET] & IEEE802154_FRAME_FLAG_FRAME_PENDING) != 0;
 }
 
 otPanId efr32GetDstPanId(otRadioFrame *aFrame)
 {
-    otPanId aPanId = 0xFFFF;
+    efr32MacFrameInfo info;
+    otPanId           aPanId = 0xFFFF;
 
-    if (static_cast<Mac::RxFrame *>(aFrame)->IsDstPanIdPresent())
+    if (efr32ParseMacFrame(aFrame, &info))
     {
-        static_cast<Mac::RxFrame *>(aFrame)->GetDstPanId(aPanId);
+        aPanId = efr32MacFrameGetDstPanId(aFrame, &info);
     }
 
     return aPanId;
@@ -348,13 +524,12 @@ otPanId efr32GetDstPanId(otRadioFrame *aFrame)
 
 uint8_t *efr32GetPayload(otRadioFrame *aFrame)
 {
-    Mac::RxFrame *rxFrame = static_cast<Mac::RxFrame *>(aFrame);
-    FrameData     payload;
-    uint8_t      *result = nullptr;
+    efr32MacFrameInfo info;
+    uint8_t          *result = nullptr;
 
-    if (rxFrame->GetPayload(payload) == OT_ERROR_NONE)
+    if (efr32ParseMacFrame(aFrame, &info))
     {
-        result = const_cast<uint8_t *>(payload.GetBytes());
+        result = efr32MacFrameGetPayload(aFrame, &info);
     }
 
     return result;
@@ -362,10 +537,10 @@ uint8_t *efr32GetPayload(otRadioFrame *aFrame)
 
 bool efr32FrameIsPanIdCompressed(otRadioFrame *aFrame)
 {
-    return static_cast<Mac::RxFrame *>(aFrame)->IsPanIdCompressed();
+    return (aFrame->mPsdu[IEEE802154_FCF_OFFSET] & IEEE802154_FRAME_FLAG_PANID_COMPRESSION) != 0;
 }
 
 uint16_t efr32GetFrameVersion(otRadioFrame *aFrame)
 {
-    return static_cast<Mac::RxFrame *>(aFrame)->GetVersion();
+    return static_cast<uint16_t>((aFrame->mPsdu[IEEE802154_FCF_OFFSET + 1] << 8) & IEEE802154_FRAME_VERSION_MASK);
 }
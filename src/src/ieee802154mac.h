@@ -44,6 +44,8 @@
 // FCF + DSN + dest PANID + dest addr + src PANID + src addr (without security header)
 #define IEEE802154_MAX_MHR_LENGTH (2 + 1 + 2 + 8 + 2 + 8)
 
+#define IEEE802154_FCS_LENGTH 2
+
 #define IEEE802154_DSN_OFFSET 2
 #define IEEE802154_FCF_OFFSET 0
 
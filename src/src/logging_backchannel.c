@@ -51,6 +51,17 @@
 
 #include "debug_channel.h"
 
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#include <openthread/logging.h>
+
+#include "logging_plat.h"
+#include "logging_tokenized.h"
+#endif
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#include "logging_ring.h"
+#endif
+
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
 static bool sLogInitialized = false;
 
@@ -59,13 +70,33 @@ static bool sLogInitialized = false;
 #endif
 
 #if (LOG_TIMESTAMP_ENABLE == 1)
-static inline int logTimestamp(char *aLogString, uint16_t aMaxSize)
+static inline int logTimestamp(char *aLogString, uint16_t aMaxSize, long unsigned int aNow)
 {
-    long unsigned int now = otPlatAlarmMilliGetNow();
-    return snprintf(aLogString, (size_t)aMaxSize, "[%010lu]", now);
+    return snprintf(aLogString, (size_t)aMaxSize, "[%010lu]", aNow);
 }
 #endif
 
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+static void utilsLogBackchannelOutput(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list ap)
+{
+    uint8_t  record[EFR32_LOG_TOKENIZED_RECORD_SIZE];
+    uint16_t length;
+
+    otEXPECT(sLogInitialized == true);
+
+    length = efr32LogTokenizedEncode(record, aLogLevel, aLogRegion, aFormat, ap);
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    // Written to the backchannel later on from efr32LogProcess(), formatted there unless tokenized.
+    efr32LogRingWrite(record, length);
+#else
+    sl_debug_binary_write(EM_DEBUG_PRINTF, record, length);
+#endif
+
+exit:
+    return;
+}
+#else
 static void utilsLogBackchannelOutput(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list ap)
 {
     OT_UNUSED_VARIABLE(aLogLevel);
@@ -78,7 +109,7 @@ static void utilsLogBackchannelOutput(otLogLevel aLogLevel, otLogRegion aLogRegi
     otEXPECT(sLogInitialized == true);
 
 #if (LOG_TIMESTAMP_ENABLE == 1)
-    length += logTimestamp(logString, LOG_PARSE_BUFFER_SIZE);
+    length += logTimestamp(logString, LOG_PARSE_BUFFER_SIZE, otPlatAlarmMilliGetNow());
 #endif
 
     charsWritten = vsnprintf(&logString[length], (size_t)(LOG_PARSE_BUFFER_SIZE - length), aFormat, ap);
@@ -92,11 +123,12 @@ static void utilsLogBackchannelOutput(otLogLevel aLogLevel, otLogRegion aLogRegi
 
     logString[length++] = '\n';
 
-    sl_debug_binary_write(EM_DEBUG_PRINTF, logString, length);
+    sl_debug_binary_write(EM_DEBUG_PRINTF, logString, (uint16_t)length);
 
 exit:
     return;
 }
+#endif // SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
 
 void efr32LogInit(void)
 {
@@ -108,6 +140,55 @@ void efr32LogDeinit(void)
     sLogInitialized = false;
 }
 
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#if !SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+// Formats a queued record the same way as utilsLogBackchannelOutput().
+static void logBackchannelWriteText(const uint8_t *aRecord, uint16_t aLength)
+{
+    uint16_t length = 0;
+    char     logString[LOG_PARSE_BUFFER_SIZE + 1];
+
+#if (LOG_TIMESTAMP_ENABLE == 1)
+    length += logTimestamp(logString, LOG_PARSE_BUFFER_SIZE, efr32LogTokenizedGetUint32(&aRecord[4]));
+#endif
+
+    length += efr32LogTokenizedFormat(&logString[length], (uint16_t)(LOG_PARSE_BUFFER_SIZE - length), aRecord,
+                                      aLength);
+    logString[length++] = '\n';
+
+    sl_debug_binary_write(EM_DEBUG_PRINTF, logString, length);
+}
+#endif
+
+void efr32LogProcess(void)
+{
+    uint8_t  record[EFR32_LOG_TOKENIZED_RECORD_SIZE];
+    uint16_t length;
+    uint32_t dropped;
+
+    while ((length = efr32LogRingRead(record, sizeof(record))) != 0)
+    {
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+        sl_debug_binary_write(EM_DEBUG_PRINTF, record, length);
+#else
+        logBackchannelWriteText(record, length);
+#endif
+    }
+
+    dropped = efr32LogRingTakeDroppedCount();
+
+    if (dropped != 0)
+    {
+        otPlatLog(OT_LOG_LEVEL_WARN, OT_LOG_REGION_PLATFORM, "%lu log records dropped", (unsigned long)dropped);
+    }
+}
+
+bool efr32LogIsPending(void)
+{
+    return efr32LogRingIsPending();
+}
+#endif // SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
 void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
 {
     va_list ap;
@@ -118,6 +199,24 @@ void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat
 
     va_end(ap);
 }
+
+#if EFR32_LOG_PLAT_ENABLE
+void efr32LogPlat(otLogLevel aLogLevel, const char *aFormat, ...)
+{
+    va_list ap;
+
+    otEXPECT(aLogLevel <= otLoggingGetLevel());
+
+    va_start(ap, aFormat);
+
+    utilsLogBackchannelOutput(aLogLevel, OT_LOG_REGION_PLATFORM, aFormat, ap);
+
+    va_end(ap);
+
+exit:
+    return;
+}
+#endif
 #endif
 
 #endif // SL_CATALOG_OT_BACKCHANNEL_LOG_PRESENT
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   Routes the platform log calls of this PAL straight to the logging backend.
+ *
+ *   The `otLog<Level>Plat()` functions of the OpenThread core format the message before handing it
+ *   to otPlatLog() as a single "%s" argument, which leaves nothing for the tokenized encoder to work
+ *   with and formats deferred logs in the calling context. When tokenized or deferred logging is
+ *   enabled this header replaces them with efr32LogPlat(), so the backend receives the original format
+ *   string and raw arguments.
+ *
+ *   It must be included after every other header of the source file using the platform log calls.
+ */
+
+#ifndef LOGGING_PLAT_H_
+#define LOGGING_PLAT_H_
+
+#include <openthread-core-config.h>
+#include <openthread/logging.h>
+#include <openthread/platform/logging.h>
+
+#ifdef SL_COMPONENT_CATALOG_PRESENT
+#include "sl_component_catalog.h"
+#endif // SL_COMPONENT_CATALOG_PRESENT
+
+#if (SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE) && OPENTHREAD_CONFIG_LOG_PLATFORM \
+    && (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)                      \
+    && (defined(SL_CATALOG_OT_RTT_LOG_PRESENT) || defined(SL_CATALOG_OT_BACKCHANNEL_LOG_PRESENT))
+#define EFR32_LOG_PLAT_ENABLE 1
+#else
+#define EFR32_LOG_PLAT_ENABLE 0
+#endif
+
+#if EFR32_LOG_PLAT_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Emits a platform log record without formatting it first.
+ *
+ * Implemented by the logging backend selected in the project. Records above the current log level
+ * are discarded.
+ *
+ * @param[in]  aLogLevel  The log level.
+ * @param[in]  aFormat    A pointer to the format string, which must reside in the firmware image.
+ * @param[in]  ...        Arguments for the format specification.
+ */
+void efr32LogPlat(otLogLevel aLogLevel, const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#undef otLogCritPlat
+#undef otLogWarnPlat
+#undef otLogNotePlat
+#undef otLogInfoPlat
+#undef otLogDebgPlat
+
+#define otLogCritPlat(...) efr32LogPlat(OT_LOG_LEVEL_CRIT, __VA_ARGS__)
+#define otLogWarnPlat(...) efr32LogPlat(OT_LOG_LEVEL_WARN, __VA_ARGS__)
+#define otLogNotePlat(...) efr32LogPlat(OT_LOG_LEVEL_NOTE, __VA_ARGS__)
+#define otLogInfoPlat(...) efr32LogPlat(OT_LOG_LEVEL_INFO, __VA_ARGS__)
+#define otLogDebgPlat(...) efr32LogPlat(OT_LOG_LEVEL_DEBG, __VA_ARGS__)
+
+#endif // EFR32_LOG_PLAT_ENABLE
+
+#endif // LOGGING_PLAT_H_
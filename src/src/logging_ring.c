@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the deferred log ring shared by the logging backends.
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread-core-config.h>
+#include <utils/code_utils.h>
+
+#include "em_core.h"
+#include "logging_ring.h"
+#include "platform-efr32.h"
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+#define EFR32_LOG_RING_STATE_BUSY 0
+#define EFR32_LOG_RING_STATE_READY 1
+#define EFR32_LOG_RING_STATE_PADDING 2
+
+#define EFR32_LOG_RING_MASK (SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE - 1U)
+
+typedef struct efr32LogRingHeader
+{
+    uint16_t         mLength; // Length of the record following the header, in bytes.
+    volatile uint8_t mState;
+    uint8_t          mReserved;
+} efr32LogRingHeader;
+
+typedef struct efr32LogRing
+{
+    uint32_t             mBuffer[SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE / sizeof(uint32_t)];
+    volatile uint32_t    mHead; // Free running offset of the oldest record.
+    volatile uint32_t    mTail; // Free running offset where the next record is reserved.
+    uint32_t             mDroppedReported;
+    efr32LogRingCounters mCounters;
+} efr32LogRing;
+
+static efr32LogRing sLogRing;
+
+static inline uint32_t efr32LogRingSlotSize(uint16_t aLength)
+{
+    return sizeof(efr32LogRingHeader) + ((aLength + sizeof(uint32_t) - 1U) & ~(sizeof(uint32_t) - 1U));
+}
+
+static inline efr32LogRingHeader *efr32LogRingHeaderAt(uint32_t aOffset)
+{
+    return (efr32LogRingHeader *)((uint8_t *)sLogRing.mBuffer + (aOffset & EFR32_LOG_RING_MASK));
+}
+
+uint8_t *efr32LogRingReserve(uint16_t aLength)
+{
+    uint32_t            slotSize = efr32LogRingSlotSize(aLength);
+    efr32LogRingHeader *header   = NULL;
+    uint32_t            padding;
+    uint32_t            used;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+
+    // A record too large for the ring is counted like any other record which could not be queued.
+    if (slotSize > SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE / 2)
+    {
+        sLogRing.mCounters.mDroppedNewest++;
+    }
+
+    otEXPECT_ACTION(slotSize <= SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE / 2, CORE_EXIT_ATOMIC());
+
+    // A record never wraps around the end of the buffer, the space left at the end is skipped instead.
+    padding = SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE - (sLogRing.mTail & EFR32_LOG_RING_MASK);
+    padding = (padding < slotSize) ? padding : 0;
+
+    while ((used = (sLogRing.mTail - sLogRing.mHead) + padding + slotSize) > SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE)
+    {
+#if SL_OPENTHREAD_DEFERRED_LOG_DROP_OLDEST
+        efr32LogRingHeader *oldest = efr32LogRingHeaderAt(sLogRing.mHead);
+
+        // Records still being written by an interrupted producer are never discarded.
+        if (oldest->mState != EFR32_LOG_RING_STATE_BUSY)
+        {
+            if (oldest->mState == EFR32_LOG_RING_STATE_READY)
+            {
+                sLogRing.mCounters.mDroppedOldest++;
+            }
+
+            sLogRing.mHead += efr32LogRingSlotSize(oldest->mLength);
+            continue;
+        }
+#endif
+        sLogRing.mCounters.mDroppedNewest++;
+        break;
+    }
+
+    otEXPECT_ACTION(used <= SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE, CORE_EXIT_ATOMIC());
+
+    if (padding != 0)
+    {
+        header          = efr32LogRingHeaderAt(sLogRing.mTail);
+        header->mLength = (uint16_t)(padding - sizeof(efr32LogRingHeader));
+        header->mState  = EFR32_LOG_RING_STATE_PADDING;
+        sLogRing.mTail += padding;
+    }
+
+    header          = efr32LogRingHeaderAt(sLogRing.mTail);
+    header->mLength = aLength;
+    header->mState  = EFR32_LOG_RING_STATE_BUSY;
+    sLogRing.mTail += slotSize;
+
+    if (used > sLogRing.mCounters.mHighWatermark)
+    {
+        sLogRing.mCounters.mHighWatermark = used;
+    }
+
+    CORE_EXIT_ATOMIC();
+
+exit:
+    return (header != NULL) ? (uint8_t *)(header + 1) : NULL;
+}
+
+void efr32LogRingCommit(uint8_t *aRecord)
+{
+    ((efr32LogRingHeader *)aRecord - 1)->mState = EFR32_LOG_RING_STATE_READY;
+}
+
+void efr32LogRingWrite(const void *aRecord, uint16_t aLength)
+{
+    uint8_t *record = efr32LogRingReserve(aLength);
+
+    otEXPECT(record != NULL);
+    memcpy(record, aRecord, aLength);
+    efr32LogRingCommit(record);
+
+exit:
+    return;
+}
+
+bool efr32LogRingIsPending(void)
+{
+    return sLogRing.mHead != sLogRing.mTail;
+}
+
+uint16_t efr32LogRingRead(uint8_t *aRecord, uint16_t aSize)
+{
+    uint16_t length = 0;
+
+    while (length == 0)
+    {
+        efr32LogRingHeader *header;
+        uint32_t            head;
+        uint8_t             state;
+
+        CORE_DECLARE_IRQ_STATE;
+
+        CORE_ENTER_ATOMIC();
+        head   = sLogRing.mHead;
+        header = efr32LogRingHeaderAt(head);
+        state  = header->mState;
+        length = header->mLength;
+        CORE_EXIT_ATOMIC();
+
+        otEXPECT_ACTION((head != sLogRing.mTail) && (state != EFR32_LOG_RING_STATE_BUSY), length = 0);
+
+        if ((state == EFR32_LOG_RING_STATE_READY) && (length <= aSize))
+        {
+            memcpy(aRecord, header + 1, length);
+        }
+        else
+        {
+            // Padding, or a record which does not fit the caller's buffer.
+            length = 0;
+        }
+
+        CORE_ENTER_ATOMIC();
+        if (sLogRing.mHead == head)
+        {
+            sLogRing.mHead = head + efr32LogRingSlotSize(header->mLength);
+        }
+        else
+        {
+            // A producer discarded the record while it was being copied.
+            length = 0;
+        }
+        CORE_EXIT_ATOMIC();
+    }
+
+exit:
+    return length;
+}
+
+uint32_t efr32LogRingTakeDroppedCount(void)
+{
+    uint32_t dropped = sLogRing.mCounters.mDroppedOldest + sLogRing.mCounters.mDroppedNewest;
+    uint32_t count   = dropped - sLogRing.mDroppedReported;
+
+    sLogRing.mDroppedReported = dropped;
+
+    return count;
+}
+
+void efr32LogGetRingCounters(efr32LogRingCounters *aCounters)
+{
+    *aCounters = sLogRing.mCounters;
+}
+
+#endif // SL_OPENTHREAD_DEFERRED_LOG_ENABLE
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   Deferred log ring shared by the logging backends.
+ *
+ *   Log producers, which may run in interrupt context, only reserve space in the ring and copy their
+ *   record into it. The records are written to the log transport later from the main loop by
+ *   efr32LogProcess(), so logging from radio callbacks does not block on the transport.
+ *
+ *   Reserving space only touches the ring indices inside a short critical section; the record itself is
+ *   copied with interrupts enabled and is published by marking it ready. Since the consumer copies a
+ *   record out before releasing it, a producer running the drop oldest policy may discard the record the
+ *   consumer is currently reading, in which case the consumer notices it and skips that record.
+ */
+
+#ifndef LOGGING_RING_H_
+#define LOGGING_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+
+#include "platform-efr32.h"
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Reserves space for a record of @p aLength bytes.
+ *
+ * Safe to call from interrupt context. The record must be published with efr32LogRingCommit().
+ *
+ * @param[in]  aLength  The length of the record, in bytes.
+ *
+ * @returns A pointer to the reserved record, or NULL if the ring is full and the record was dropped.
+ */
+uint8_t *efr32LogRingReserve(uint16_t aLength);
+
+/**
+ * Publishes a record reserved with efr32LogRingReserve().
+ *
+ * @param[in]  aRecord  A pointer to the reserved record.
+ */
+void efr32LogRingCommit(uint8_t *aRecord);
+
+/**
+ * Copies @p aLength bytes into a newly reserved record and publishes it.
+ *
+ * @param[in]  aRecord  A pointer to the record content.
+ * @param[in]  aLength  The length of the record, in bytes.
+ */
+void efr32LogRingWrite(const void *aRecord, uint16_t aLength);
+
+/**
+ * Indicates whether published records are waiting to be drained.
+ */
+bool efr32LogRingIsPending(void);
+
+/**
+ * Reads the oldest published record and releases it.
+ *
+ * Must only be called from the main loop.
+ *
+ * @param[out]  aRecord  A buffer receiving the record.
+ * @param[in]   aSize    The size of @p aRecord, in bytes.
+ *
+ * @returns The length of the record copied to @p aRecord, or 0 if no record is ready.
+ */
+uint16_t efr32LogRingRead(uint8_t *aRecord, uint16_t aSize);
+
+/**
+ * Returns the number of records dropped since the previous call.
+ */
+uint32_t efr32LogRingTakeDroppedCount(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+#endif // LOGGING_RING_H_
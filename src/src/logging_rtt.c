@@ -45,27 +45,181 @@
 
 #include <utils/logging_rtt.h>
 
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#include <stdio.h>
+#include <utils/code_utils.h>
+#include <openthread/logging.h>
+
+#include "SEGGER_RTT.h"
+#include "logging_plat.h"
+#include "logging_tokenized.h"
+#endif
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#include "logging_ring.h"
+#endif
+
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+static bool sLogInitialized = false;
+#endif
+
 void efr32LogInit(void)
 {
     utilsLogRttInit();
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    sLogInitialized = true;
+#endif
 }
 
 void efr32LogDeinit(void)
 {
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    sLogInitialized = false;
+#endif
     utilsLogRttDeinit();
 }
 
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#if !SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+#if (LOG_RTT_COLOR_ENABLE == 1)
+#define RTT_COLOR_CODE_DEFAULT "\x1B[0m"
+#define RTT_COLOR_CODE_RED "\x1B[1;31m"
+#define RTT_COLOR_CODE_GREEN "\x1B[1;32m"
+#define RTT_COLOR_CODE_YELLOW "\x1B[1;33m"
+#define RTT_COLOR_CODE_CYAN "\x1B[1;36m"
+#else
+#define RTT_COLOR_CODE_DEFAULT ""
+#define RTT_COLOR_CODE_RED ""
+#define RTT_COLOR_CODE_GREEN ""
+#define RTT_COLOR_CODE_YELLOW ""
+#define RTT_COLOR_CODE_CYAN ""
+#endif
+
+static const char *logRttLevelColor(uint8_t aLogLevel)
+{
+    const char *color;
+
+    switch (aLogLevel)
+    {
+    case OT_LOG_LEVEL_CRIT:
+        color = RTT_COLOR_CODE_RED;
+        break;
+
+    case OT_LOG_LEVEL_WARN:
+        color = RTT_COLOR_CODE_YELLOW;
+        break;
+
+    case OT_LOG_LEVEL_INFO:
+        color = RTT_COLOR_CODE_GREEN;
+        break;
+
+    default:
+        color = RTT_COLOR_CODE_DEFAULT;
+        break;
+    }
+
+    return color;
+}
+
+// Formats a queued record with the same timestamp and level prefix as utilsLogRttOutput().
+static void logRttWriteText(const uint8_t *aRecord, uint16_t aLength)
+{
+    char logString[LOG_PARSE_BUFFER_SIZE + 1];
+    int  length = 0;
+
+#if (LOG_TIMESTAMP_ENABLE == 1)
+    length += snprintf(logString, sizeof(logString), "%s[%010lu]", RTT_COLOR_CODE_CYAN,
+                       (unsigned long)efr32LogTokenizedGetUint32(&aRecord[4]));
+#endif
+    length += snprintf(&logString[length], sizeof(logString) - (size_t)length, "%s",
+                       logRttLevelColor(aRecord[2] & ~EFR32_LOG_TOKENIZED_FLAG_TRUNCATED));
+    otEXPECT(length < LOG_PARSE_BUFFER_SIZE);
+
+    length += efr32LogTokenizedFormat(&logString[length], (uint16_t)(LOG_PARSE_BUFFER_SIZE - length), aRecord,
+                                      aLength);
+    logString[length++] = '\n';
+
+    SEGGER_RTT_Write(LOG_RTT_BUFFER_INDEX, logString, (unsigned)length);
+
+exit:
+    return;
+}
+#endif // !SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+
+void efr32LogProcess(void)
+{
+    uint8_t  record[EFR32_LOG_TOKENIZED_RECORD_SIZE];
+    uint16_t length;
+    uint32_t dropped;
+
+    while ((length = efr32LogRingRead(record, sizeof(record))) != 0)
+    {
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+        SEGGER_RTT_Write(LOG_RTT_BUFFER_INDEX, record, length);
+#else
+        logRttWriteText(record, length);
+#endif
+    }
+
+    dropped = efr32LogRingTakeDroppedCount();
+
+    if (dropped != 0)
+    {
+        otPlatLog(OT_LOG_LEVEL_WARN, OT_LOG_REGION_PLATFORM, "%lu log records dropped", (unsigned long)dropped);
+    }
+}
+
+bool efr32LogIsPending(void)
+{
+    return efr32LogRingIsPending();
+}
+#endif // SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+static void logRttOutput(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list ap)
+{
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    // Deferred records are only formatted when drained, see logRttWriteText().
+    if (sLogInitialized)
+    {
+        uint8_t  record[EFR32_LOG_TOKENIZED_RECORD_SIZE];
+        uint16_t length = efr32LogTokenizedEncode(record, aLogLevel, aLogRegion, aFormat, ap);
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+        efr32LogRingWrite(record, length);
+#else
+        SEGGER_RTT_Write(LOG_RTT_BUFFER_INDEX, record, length);
+#endif
+    }
+#else
+    utilsLogRttOutput(aLogLevel, aLogRegion, aFormat, ap);
+#endif
+}
+
 void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
 {
     va_list ap;
 
     va_start(ap, aFormat);
+    logRttOutput(aLogLevel, aLogRegion, aFormat, ap);
+    va_end(ap);
+}
 
-    utilsLogRttOutput(aLogLevel, aLogRegion, aFormat, ap);
+#if EFR32_LOG_PLAT_ENABLE
+void efr32LogPlat(otLogLevel aLogLevel, const char *aFormat, ...)
+{
+    va_list ap;
+
+    otEXPECT(aLogLevel <= otLoggingGetLevel());
 
+    va_start(ap, aFormat);
+    logRttOutput(aLogLevel, OT_LOG_REGION_PLATFORM, aFormat, ap);
     va_end(ap);
+
+exit:
+    return;
 }
 #endif
+#endif
 
 #endif // SL_CATALOG_OT_RTT_LOG_PRESENT
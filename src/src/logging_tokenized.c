@@ -0,0 +1,383 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tokenized log record encoder and decoder shared by the logging backends.
+ *
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread-core-config.h>
+#include <utils/code_utils.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/logging.h>
+
+#include "logging_tokenized.h"
+
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+uint16_t efr32LogTokenizedEncode(uint8_t    *aRecord,
+                                 otLogLevel  aLogLevel,
+                                 otLogRegion aLogRegion,
+                                 const char *aFormat,
+                                 va_list     ap)
+{
+    uint8_t    *payload   = &aRecord[EFR32_LOG_TOKENIZED_HEADER_SIZE];
+    uint16_t    length    = 0;
+    uint8_t     flags     = 0;
+    const char *character = aFormat;
+
+    while (*character != '\0')
+    {
+        uint8_t  longCount = 0;
+        uint32_t precision = UINT32_MAX;
+
+        if (*character++ != '%')
+        {
+            continue;
+        }
+
+        if (*character == '%')
+        {
+            character++;
+            continue;
+        }
+
+        while ((*character == '-') || (*character == '+') || (*character == ' ') || (*character == '#')
+               || (*character == '0'))
+        {
+            character++;
+        }
+
+        // Width and precision given as `*` are passed as int arguments ahead of the value.
+        while (((*character >= '0') && (*character <= '9')) || (*character == '*') || (*character == '.'))
+        {
+            if (*character == '.')
+            {
+                precision = 0;
+            }
+            else if (*character == '*')
+            {
+                int value = va_arg(ap, int);
+
+                if (precision == 0)
+                {
+                    precision = (value >= 0) ? (uint32_t)value : UINT32_MAX;
+                }
+
+                otEXPECT_ACTION((length + sizeof(uint32_t)) <= EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE,
+                                flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED);
+                efr32LogTokenizedPutUint32(&payload[length], (uint32_t)value);
+                length += sizeof(uint32_t);
+            }
+            else if (precision != UINT32_MAX)
+            {
+                precision = (precision * 10) + (uint32_t)(*character - '0');
+            }
+
+            character++;
+        }
+
+        while ((*character == 'h') || (*character == 'l') || (*character == 'L') || (*character == 'j')
+               || (*character == 'z') || (*character == 't'))
+        {
+            if (*character == 'l')
+            {
+                longCount++;
+            }
+            else if (*character == 'j')
+            {
+                longCount = 2;
+            }
+
+            character++;
+        }
+
+        switch (*character)
+        {
+        case 's':
+        {
+            const char *string = va_arg(ap, const char *);
+            size_t      size   = (string != NULL) ? strlen(string) : 0;
+
+            otEXPECT_ACTION(length < EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE,
+                            flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED);
+
+            if (size > precision)
+            {
+                size = precision;
+            }
+
+            if ((length + 1U + size) > EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE)
+            {
+                size  = EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE - length - 1U;
+                flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED;
+            }
+
+            payload[length++] = (uint8_t)size;
+            memcpy(&payload[length], string, size);
+            length += (uint16_t)size;
+            otEXPECT(flags == 0);
+            break;
+        }
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value = va_arg(ap, double);
+
+            otEXPECT_ACTION((length + sizeof(value)) <= EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE,
+                            flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED);
+            memcpy(&payload[length], &value, sizeof(value));
+            length += sizeof(value);
+            break;
+        }
+
+        case 'n':
+            // Nothing is written back to the caller, the argument is not recorded.
+            (void)va_arg(ap, int *);
+            break;
+
+        case '\0':
+            continue;
+
+        default:
+            if (longCount >= 2)
+            {
+                uint64_t value = va_arg(ap, uint64_t);
+
+                otEXPECT_ACTION((length + sizeof(value)) <= EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE,
+                                flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED);
+                efr32LogTokenizedPutUint32(&payload[length], (uint32_t)value);
+                efr32LogTokenizedPutUint32(&payload[length + sizeof(uint32_t)], (uint32_t)(value >> 32));
+                length += sizeof(value);
+            }
+            else
+            {
+                // Integer, character and pointer conversions are all 32 bits wide on this platform.
+                uint32_t value = va_arg(ap, uint32_t);
+
+                otEXPECT_ACTION((length + sizeof(value)) <= EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE,
+                                flags = EFR32_LOG_TOKENIZED_FLAG_TRUNCATED);
+                efr32LogTokenizedPutUint32(&payload[length], value);
+                length += sizeof(value);
+            }
+            break;
+        }
+
+        character++;
+    }
+
+exit:
+    aRecord[0] = EFR32_LOG_TOKENIZED_SYNC;
+    aRecord[1] = (uint8_t)length;
+    aRecord[2] = (uint8_t)aLogLevel | flags;
+    aRecord[3] = (uint8_t)aLogRegion;
+    efr32LogTokenizedPutUint32(&aRecord[4], otPlatAlarmMilliGetNow());
+    efr32LogTokenizedPutUint32(&aRecord[8], (uint32_t)(uintptr_t)aFormat);
+
+    return EFR32_LOG_TOKENIZED_HEADER_SIZE + length;
+}
+
+uint16_t efr32LogTokenizedFormat(char *aText, uint16_t aSize, const uint8_t *aRecord, uint16_t aLength)
+{
+    const char    *character = (const char *)(uintptr_t)efr32LogTokenizedGetUint32(&aRecord[8]);
+    const uint8_t *payload   = &aRecord[EFR32_LOG_TOKENIZED_HEADER_SIZE];
+    uint16_t       available = aRecord[1];
+    uint16_t       offset    = 0;
+    uint16_t       length    = 0;
+
+    otEXPECT(aSize > 0);
+
+    if (available > (aLength - EFR32_LOG_TOKENIZED_HEADER_SIZE))
+    {
+        available = aLength - EFR32_LOG_TOKENIZED_HEADER_SIZE;
+    }
+
+    while ((*character != '\0') && (length < (aSize - 1)))
+    {
+        char    spec[EFR32_LOG_TOKENIZED_SPEC_SIZE];
+        uint8_t specLength = 0;
+        uint8_t precision  = 0; // Offset of the precision in `spec`, 0 if there is none.
+        uint8_t longCount  = 0;
+        int     written    = 0;
+
+        if (*character != '%')
+        {
+            aText[length++] = *character++;
+            continue;
+        }
+
+        spec[specLength++] = *character++;
+
+        if (*character == '%')
+        {
+            aText[length++] = *character++;
+            continue;
+        }
+
+        while ((*character == '-') || (*character == '+') || (*character == ' ') || (*character == '#')
+               || (*character == '0') || ((*character >= '1') && (*character <= '9')) || (*character == '*')
+               || (*character == '.'))
+        {
+            // Leave room for a `*` argument, the longest length modifier and the conversion.
+            otEXPECT(specLength < (sizeof(spec) - 16));
+
+            if (*character == '*')
+            {
+                otEXPECT((offset + sizeof(uint32_t)) <= available);
+                specLength += (uint8_t)snprintf(&spec[specLength], sizeof(spec) - specLength, "%ld",
+                                                (long)(int32_t)efr32LogTokenizedGetUint32(&payload[offset]));
+                offset += sizeof(uint32_t);
+            }
+            else
+            {
+                if (*character == '.')
+                {
+                    precision = specLength;
+                }
+
+                spec[specLength++] = *character;
+            }
+
+            character++;
+        }
+
+        while ((*character == 'h') || (*character == 'l') || (*character == 'L') || (*character == 'j')
+               || (*character == 'z') || (*character == 't'))
+        {
+            otEXPECT(specLength < (sizeof(spec) - 2));
+
+            if (*character == 'l')
+            {
+                longCount++;
+            }
+            else if (*character == 'j')
+            {
+                longCount = 2;
+            }
+
+            spec[specLength++] = *character++;
+        }
+
+        otEXPECT(*character != '\0');
+        spec[specLength++] = *character;
+        spec[specLength]   = '\0';
+
+        switch (*character)
+        {
+        case 's':
+        {
+            uint8_t size;
+
+            otEXPECT(offset < available);
+            size = payload[offset++];
+            otEXPECT((offset + size) <= available);
+
+            // The string was cut to the precision when recorded and is not null terminated.
+            specLength = (precision != 0) ? precision : (uint8_t)(specLength - 1);
+            memcpy(&spec[specLength], ".*s", sizeof(".*s"));
+            written = snprintf(&aText[length], aSize - length, spec, (int)size, (const char *)&payload[offset]);
+            offset += size;
+            break;
+        }
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value;
+
+            otEXPECT((offset + sizeof(value)) <= available);
+            memcpy(&value, &payload[offset], sizeof(value));
+            written = snprintf(&aText[length], aSize - length, spec, value);
+            offset += sizeof(value);
+            break;
+        }
+
+        case 'n':
+            break;
+
+        case 'p':
+            otEXPECT((offset + sizeof(uint32_t)) <= available);
+            written = snprintf(&aText[length], aSize - length, spec,
+                               (void *)(uintptr_t)efr32LogTokenizedGetUint32(&payload[offset]));
+            offset += sizeof(uint32_t);
+            break;
+
+        default:
+            if (longCount >= 2)
+            {
+                uint64_t value;
+
+                otEXPECT((offset + sizeof(value)) <= available);
+                value = efr32LogTokenizedGetUint32(&payload[offset]);
+                value |= (uint64_t)efr32LogTokenizedGetUint32(&payload[offset + sizeof(uint32_t)]) << 32;
+                written = snprintf(&aText[length], aSize - length, spec, value);
+                offset += sizeof(value);
+            }
+            else
+            {
+                otEXPECT((offset + sizeof(uint32_t)) <= available);
+                written = snprintf(&aText[length], aSize - length, spec, efr32LogTokenizedGetUint32(&payload[offset]));
+                offset += sizeof(uint32_t);
+            }
+            break;
+        }
+
+        otEXPECT(written >= 0);
+        length = ((length + written) < aSize) ? (uint16_t)(length + written) : (uint16_t)(aSize - 1);
+        character++;
+    }
+
+exit:
+    if (aSize > 0)
+    {
+        aText[length] = '\0';
+    }
+
+    return length;
+}
+
+#endif // SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   Tokenized binary log record encoder shared by the logging backends.
+ *
+ *   Instead of formatting a log line on the device, the address of the format string and the raw
+ *   arguments are written as a compact binary record. The format strings stay in the firmware image
+ *   and `script/decode_tokenized_log.py` rebuilds the text on the host from the matching ELF file.
+ *
+ *   Record layout (multi-byte fields are little endian):
+ *
+ *     | Offset | Size | Field                                                      |
+ *     |--------|------|------------------------------------------------------------|
+ *     | 0      | 1    | Sync byte (EFR32_LOG_TOKENIZED_SYNC)                       |
+ *     | 1      | 1    | Length of the argument payload in bytes                    |
+ *     | 2      | 1    | Log level, EFR32_LOG_TOKENIZED_FLAG_TRUNCATED if truncated |
+ *     | 3      | 1    | Log region                                                 |
+ *     | 4      | 4    | Timestamp in milliseconds                                  |
+ *     | 8      | 4    | Address of the format string                               |
+ *     | 12     | N    | Arguments, in format string order                          |
+ *
+ *   Integer, character and pointer arguments take 4 bytes, `ll`/`j` integers and floating point
+ *   arguments take 8 bytes. String arguments are copied as a length byte followed by the characters.
+ */
+
+#ifndef LOGGING_TOKENIZED_H_
+#define LOGGING_TOKENIZED_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+#include <openthread/platform/logging.h>
+
+#if SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EFR32_LOG_TOKENIZED_SYNC 0xA5
+#define EFR32_LOG_TOKENIZED_FLAG_TRUNCATED 0x80
+#define EFR32_LOG_TOKENIZED_HEADER_SIZE 12
+#define EFR32_LOG_TOKENIZED_SPEC_SIZE 32
+
+#if (OPENTHREAD_CONFIG_LOG_MAX_SIZE < UINT8_MAX)
+#define EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE OPENTHREAD_CONFIG_LOG_MAX_SIZE
+#else
+#define EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE UINT8_MAX
+#endif
+
+#define EFR32_LOG_TOKENIZED_RECORD_SIZE (EFR32_LOG_TOKENIZED_HEADER_SIZE + EFR32_LOG_TOKENIZED_MAX_PAYLOAD_SIZE)
+
+static inline void efr32LogTokenizedPutUint32(uint8_t *aBuffer, uint32_t aValue)
+{
+    aBuffer[0] = (uint8_t)(aValue);
+    aBuffer[1] = (uint8_t)(aValue >> 8);
+    aBuffer[2] = (uint8_t)(aValue >> 16);
+    aBuffer[3] = (uint8_t)(aValue >> 24);
+}
+
+static inline uint32_t efr32LogTokenizedGetUint32(const uint8_t *aBuffer)
+{
+    return (uint32_t)aBuffer[0] | ((uint32_t)aBuffer[1] << 8) | ((uint32_t)aBuffer[2] << 16)
+           | ((uint32_t)aBuffer[3] << 24);
+}
+
+/**
+ * Encodes a log call into a tokenized binary record.
+ *
+ * The format string is only scanned for its conversion specifiers, nothing is formatted on the device.
+ * Arguments which do not fit in the record are dropped and the record is flagged as truncated.
+ *
+ * @param[out] aRecord     A pointer to a buffer of at least EFR32_LOG_TOKENIZED_RECORD_SIZE bytes.
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aFormat     A pointer to the format string, which must reside in the firmware image.
+ * @param[in]  ap          The arguments matching @p aFormat.
+ *
+ * @returns The number of bytes written to @p aRecord.
+ */
+uint16_t efr32LogTokenizedEncode(uint8_t    *aRecord,
+                                 otLogLevel  aLogLevel,
+                                 otLogRegion aLogRegion,
+                                 const char *aFormat,
+                                 va_list     ap);
+
+/**
+ * Formats the message of a tokenized record into text.
+ *
+ * Used to drain deferred records as text. The format string is read from the address found in the record,
+ * so the record must have been encoded by the running firmware. Formatting stops at the first argument
+ * missing from a truncated record.
+ *
+ * @param[out] aText    A pointer to the output buffer, always null terminated.
+ * @param[in]  aSize    The size of @p aText, in bytes.
+ * @param[in]  aRecord  A pointer to the record.
+ * @param[in]  aLength  The length of @p aRecord, in bytes.
+ *
+ * @returns The number of characters written to @p aText, not counting the null terminator.
+ */
+uint16_t efr32LogTokenizedFormat(char *aText, uint16_t aSize, const uint8_t *aRecord, uint16_t aLength);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SL_OPENTHREAD_TOKENIZED_LOG_ENABLE || SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+
+#endif // LOGGING_TOKENIZED_H_
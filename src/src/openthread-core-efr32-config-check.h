@@ -48,6 +48,39 @@
     "One of the following must be defined: RADIO_CONFIG_915MHZ_OQPSK_SUPPORT, RADIO_CONFIG_SUBGHZ_SUPPORT or RADIO_CONFIG_2P4GHZ_OQPSK_SUPPORT"
 #endif
 
+#if SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE > 65535
+#error "SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE must fit in 16 bits, SPI transaction lengths are uint16_t."
+#endif
+
+#if SL_OPENTHREAD_DEFERRED_LOG_ENABLE \
+    && ((SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE & (SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE - 1)) != 0)
+#error "SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE must be a power of two."
+#endif
+
+#if ((SL_OPENTHREAD_COEX_EVENT_RING_SIZE & (SL_OPENTHREAD_COEX_EVENT_RING_SIZE - 1)) != 0) \
+    || (SL_OPENTHREAD_COEX_EVENT_RING_SIZE > 128)
+#error "SL_OPENTHREAD_COEX_EVENT_RING_SIZE must be a power of two, no larger than 128."
+#endif
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE \
+    && ((SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE & (SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE - 1)) != 0)
+#error "SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE must be a power of two."
+#endif
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE                                                                   \
+    && (((SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE & (SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE - 1)) != 0) \
+        || (SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE < 256))
+#error "SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE must be a power of two, no smaller than 256."
+#endif
+
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE && !OPENTHREAD_CONFIG_DIAG_ENABLE
+#error "SL_OPENTHREAD_RADIO_BENCH_ENABLE requires OPENTHREAD_CONFIG_DIAG_ENABLE."
+#endif
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE && (SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM > SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM)
+#error "SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM must not exceed SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM."
+#endif
+
 #if defined(_SILICON_LABS_32B_SERIES_1)
 #error "EFR32 Series 1 parts are not supported."
 #endif
@@ -417,6 +417,19 @@
 #define OPENTHREAD_CONFIG_NCP_SPI_ENABLE 0
 #endif
 
+/**
+ * @def SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE
+ *
+ * Maximum number of bytes accepted by otPlatSpiSlavePrepareTransaction() for a single SPI transaction.
+ *
+ * Buffers larger than a single LDMA descriptor can carry are split across a chain of linked descriptors,
+ * so a transaction of up to this size is handled as one DMA transfer.
+ *
+ */
+#ifndef SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE
+#define SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE 4096
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MIN_SLEEP_DURATION_MS
  *
@@ -562,6 +575,330 @@
 #define SL_OPENTHREAD_RADIO_CCA_MODE SL_RAIL_IEEE802154_CCA_MODE_RSSI
 #endif
 
+/**
+ * @def SL_OPENTHREAD_ENERGY_SWEEP_PERCENTILE
+ *
+ * Percentile of the RSSI samples reported for each channel of an energy sweep.
+ *
+ * The percentile is resolved from a histogram with 4 dB wide bins.
+ *
+ */
+#ifndef SL_OPENTHREAD_ENERGY_SWEEP_PERCENTILE
+#define SL_OPENTHREAD_ENERGY_SWEEP_PERCENTILE 90
+#endif
+
+/**
+ * @def SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+ *
+ * Define to 1 to sample the RSSI of the current channel while the radio idles in receive, in order to
+ * track its noise floor and how often it is busy.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+#define SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_NOISE_FLOOR_MONITOR_INTERVAL_US
+ *
+ * Default interval between two noise floor samples, in microseconds. 0 keeps the monitor stopped until
+ * an interval is set at runtime.
+ *
+ */
+#ifndef SL_OPENTHREAD_NOISE_FLOOR_MONITOR_INTERVAL_US
+#define SL_OPENTHREAD_NOISE_FLOOR_MONITOR_INTERVAL_US 10000
+#endif
+
+/**
+ * @def SL_OPENTHREAD_NOISE_FLOOR_MONITOR_WINDOW
+ *
+ * Number of samples in the rolling window of the noise floor monitor. Older samples are aged out by
+ * halving the histogram each time the window fills up.
+ *
+ */
+#ifndef SL_OPENTHREAD_NOISE_FLOOR_MONITOR_WINDOW
+#define SL_OPENTHREAD_NOISE_FLOOR_MONITOR_WINDOW 1000
+#endif
+
+/**
+ * @def SL_OPENTHREAD_NOISE_FLOOR_MONITOR_PERCENTILE
+ *
+ * Percentile of the rolling window samples reported as the noise floor estimate.
+ *
+ */
+#ifndef SL_OPENTHREAD_NOISE_FLOOR_MONITOR_PERCENTILE
+#define SL_OPENTHREAD_NOISE_FLOOR_MONITOR_PERCENTILE 10
+#endif
+
+/**
+ * @def SL_OPENTHREAD_COEX_EVENT_RING_SIZE
+ *
+ * Number of recent coex events kept with their timestamp when OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE is set.
+ * Must be a power of two, no larger than 128.
+ *
+ */
+#ifndef SL_OPENTHREAD_COEX_EVENT_RING_SIZE
+#define SL_OPENTHREAD_COEX_EVENT_RING_SIZE 32
+#endif
+
+/**
+ * @def SL_OPENTHREAD_RADIO_TRACE_ENABLE
+ *
+ * Define to 1 to record the radio events, with their RAIL timestamp, in a ring buffer for latency analysis
+ * with `script/analyze_radio_trace.py`.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_RADIO_TRACE_ENABLE
+#define SL_OPENTHREAD_RADIO_TRACE_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE
+ *
+ * Number of entries of the radio trace ring buffer, each taking 8 bytes. Must be a power of two.
+ *
+ */
+#ifndef SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE
+#define SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE 256
+#endif
+
+/**
+ * @def SL_OPENTHREAD_TX_STATS_ENABLE
+ *
+ * Define to 1 to keep per interface histograms of the transmit latencies, CSMA backoffs and acknowledgment
+ * wait times.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_TX_STATS_ENABLE
+#define SL_OPENTHREAD_TX_STATS_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+ *
+ * Define to 1 to adjust the CCA energy detect threshold at runtime, based on the outcome of the recent
+ * transmissions and, when SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE is set, on the measured noise floor.
+ *
+ * The controller starts disabled and is turned on with otPlatRadioExtensionSetAdaptiveCcaEnabled(). A threshold
+ * set by the host through otPlatRadioSetCcaEnergyDetectThreshold() turns it off again.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+#define SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM
+ *
+ * Lowest CCA energy detect threshold the adaptive controller may select, in dBm.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM
+#define SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM (-90)
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM
+ *
+ * Highest CCA energy detect threshold the adaptive controller may select, in dBm.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM
+#define SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM (-60)
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_WINDOW
+ *
+ * Number of transmissions evaluated by the adaptive CCA controller before each adjustment.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_WINDOW
+#define SL_OPENTHREAD_ADAPTIVE_CCA_WINDOW 32
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB
+ *
+ * Amount by which the adaptive CCA controller moves the threshold on each adjustment, in dB.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB
+#define SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB 2
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_NOISE_MARGIN_DB
+ *
+ * Margin above the noise floor the adaptive CCA controller converges to when transmissions go well, in dB.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_NOISE_MARGIN_DB
+#define SL_OPENTHREAD_ADAPTIVE_CCA_NOISE_MARGIN_DB 10
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_CCA_FAIL_LIMIT_PERCENT
+ *
+ * Share of channel access failures in a window above which the adaptive CCA controller raises the threshold.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_CCA_FAIL_LIMIT_PERCENT
+#define SL_OPENTHREAD_ADAPTIVE_CCA_CCA_FAIL_LIMIT_PERCENT 20
+#endif
+
+/**
+ * @def SL_OPENTHREAD_ADAPTIVE_CCA_NO_ACK_LIMIT_PERCENT
+ *
+ * Share of missing acknowledgments in a window above which the adaptive CCA controller lowers the threshold,
+ * as they hint at collisions with transmissions the CCA did not detect.
+ *
+ */
+#ifndef SL_OPENTHREAD_ADAPTIVE_CCA_NO_ACK_LIMIT_PERCENT
+#define SL_OPENTHREAD_ADAPTIVE_CCA_NO_ACK_LIMIT_PERCENT 25
+#endif
+
+/**
+ * @def SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+ *
+ * Define to 1 to count the received and transmitted frames by channel and by interface.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+#define SL_OPENTHREAD_RADIO_COUNTERS_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+ *
+ * Define to 1 to account the time spent by the radio in sleep, receive, scheduled receive, transmit,
+ * acknowledgment transmit and energy scan, to compute its duty cycle.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+#define SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+ *
+ * Define to 1 for a CSL receiver to learn the clock drift against its parent from the offset of the frames
+ * received in its CSL windows, and to report it in place of the crystal accuracy when it is lower, so that the
+ * CSL receive windows shrink.
+ *
+ * Default value is 0 (disabled). The sleepy-demo-ssed platform project enables it.
+ */
+#ifndef SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+#define SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_CSL_DRIFT_MARGIN_PPM
+ *
+ * Margin added to the learned CSL clock drift before reporting it, in ppm.
+ *
+ */
+#ifndef SL_OPENTHREAD_CSL_DRIFT_MARGIN_PPM
+#define SL_OPENTHREAD_CSL_DRIFT_MARGIN_PPM 2
+#endif
+
+/**
+ * @def SL_OPENTHREAD_CSL_DRIFT_MIN_SAMPLES
+ *
+ * Number of frames received in CSL windows before the learned CSL clock drift is reported.
+ *
+ */
+#ifndef SL_OPENTHREAD_CSL_DRIFT_MIN_SAMPLES
+#define SL_OPENTHREAD_CSL_DRIFT_MIN_SAMPLES 4
+#endif
+
+/**
+ * @def SL_OPENTHREAD_CSL_DRIFT_MIN_INTERVAL_MS
+ *
+ * Minimum time between the last CSL phase reported to the parent and a frame received in a CSL window for the
+ * frame to be used to learn the CSL clock drift, in milliseconds. Over shorter intervals the transmit uncertainty
+ * of the parent dominates the measured offset.
+ *
+ */
+#ifndef SL_OPENTHREAD_CSL_DRIFT_MIN_INTERVAL_MS
+#define SL_OPENTHREAD_CSL_DRIFT_MIN_INTERVAL_MS 1000
+#endif
+
+/**
+ * @def SL_OPENTHREAD_CSL_DRIFT_MAX_SAMPLE_AGE_MS
+ *
+ * Time after the last frame received in a CSL window at which the learned CSL clock drift stops being reported,
+ * in milliseconds. The crystal accuracy is reported again instead, so that receive windows which became too
+ * narrow to catch the frames of the parent widen back until new frames refresh the estimate.
+ *
+ */
+#ifndef SL_OPENTHREAD_CSL_DRIFT_MAX_SAMPLE_AGE_MS
+#define SL_OPENTHREAD_CSL_DRIFT_MAX_SAMPLE_AGE_MS 60000
+#endif
+
+/**
+ * @def SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE
+ *
+ * Number of scheduled receive windows which can be pending at once, see otPlatRadioReceiveAt() and
+ * otPlatRadioExtensionScheduleRxWindows().
+ *
+ */
+#ifndef SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE
+#define SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE 4
+#endif
+
+/**
+ * @def SL_OPENTHREAD_GP_TX_TABLE_SIZE
+ *
+ * Number of Green Power frames which can be buffered at once on a multipan RCP, waiting for their GPD to request
+ * them. One frame is buffered per GPD, see sl_gp_interface.c.
+ *
+ */
+#ifndef SL_OPENTHREAD_GP_TX_TABLE_SIZE
+#define SL_OPENTHREAD_GP_TX_TABLE_SIZE 4
+#endif
+
+/**
+ * @def SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+ *
+ * Define to 1 to support the sniffer capture mode, which batches the received frames in a buffer read by the
+ * host with otPlatRadioExtensionReadSnifferCapture() instead of reporting them one by one.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+#define SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE
+ *
+ * Size in bytes of the sniffer capture buffer. A frame takes its length plus 12 bytes. Must be a power of two,
+ * no smaller than 256.
+ *
+ */
+#ifndef SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE
+#define SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE 8192
+#endif
+
+/**
+ * @def SL_OPENTHREAD_RADIO_BENCH_ENABLE
+ *
+ * Define to 1 to account the CPU cycles spent in the radio transmit, receive and ACK paths with the DWT cycle
+ * counter, as reported by the `diag bench` commands. The accounting is only available on the device.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_RADIO_BENCH_ENABLE
+#define SL_OPENTHREAD_RADIO_BENCH_ENABLE 0
+#endif
+
 /**
  * @def SL_OPENTHREAD_ECDSA_PRIVATE_KEY_SIZE
  *
@@ -618,6 +955,66 @@
 #define SL_OPENTHREAD_HOST_CLEAR_PIN_TIMEOUT_MS 10
 #endif
 
+/**
+ * @def SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+ *
+ * Define to 1 to have the RTT and backchannel logging backends emit tokenized binary log records
+ * instead of formatted text.
+ *
+ * A record carries the address of the format string and the raw arguments, so no formatting happens
+ * on the device. Use script/decode_tokenized_log.py with the firmware ELF file to turn the records back
+ * into text.
+ *
+ * Only the platform log calls of this PAL are tokenized with their own format string, see logging_plat.h.
+ * They skip the formatting of the text, which is where the saving is. Logs of the OpenThread core reach
+ * otPlatLog() already formatted and are carried as a single string argument, their only saving is the
+ * smaller record on the transport. `diag bench log` measures the cycles of a platform log call, to compare
+ * builds with and without tokenized logging.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_TOKENIZED_LOG_ENABLE
+#define SL_OPENTHREAD_TOKENIZED_LOG_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+ *
+ * Define to 1 to have the RTT and backchannel logging backends queue log records in a ring buffer
+ * instead of writing them to the transport from the logging context.
+ *
+ * The ring is drained from the main loop, so logging from interrupt context only costs a copy. Records
+ * hold the format string address and raw arguments, the text is only formatted when the ring is drained.
+ *
+ * Default value is 0 (disabled).
+ */
+#ifndef SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+#define SL_OPENTHREAD_DEFERRED_LOG_ENABLE 0
+#endif
+
+/**
+ * @def SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE
+ *
+ * Size of the deferred log ring in bytes, must be a power of two.
+ *
+ */
+#ifndef SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE
+#define SL_OPENTHREAD_DEFERRED_LOG_BUFFER_SIZE 2048
+#endif
+
+/**
+ * @def SL_OPENTHREAD_DEFERRED_LOG_DROP_OLDEST
+ *
+ * Policy applied when the deferred log ring is full.
+ *
+ * Define to 1 to discard the oldest queued records to make room for a new one, or to 0 to discard the
+ * new record instead.
+ *
+ */
+#ifndef SL_OPENTHREAD_DEFERRED_LOG_DROP_OLDEST
+#define SL_OPENTHREAD_DEFERRED_LOG_DROP_OLDEST 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_POWER_CALIBRATION_ENABLE
  *
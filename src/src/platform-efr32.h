@@ -51,6 +51,7 @@ extern "C" {
 #include "sl_rail.h"
 
 #include "alarm.h"
+#include "sl_radio_extension.h"
 #include "uart.h"
 
 // Global OpenThread instance structure
@@ -73,6 +74,32 @@ extern otInstance *sInstance;
 
 extern sl_rail_handle_t gRailHandle; // coex needs the emPhyRailHandle symbol.
 
+// Radio reconfiguration counters, shared with the radio power manager.
+extern efr32RadioReconfigCounters gRadioReconfigCounters;
+
+/**
+ * Returns the bin of a latency in a log2 histogram of @p aBinCount bins.
+ *
+ * Bin 0 holds latencies below 2us, bin N those in [2^N, 2^(N+1)) us and the last bin everything above.
+ *
+ * @param[in]  aLatencyUs  The latency, in microseconds.
+ * @param[in]  aBinCount   The number of bins of the histogram.
+ *
+ * @returns The index of the bin, below @p aBinCount.
+ *
+ */
+static inline uint8_t efr32LatencyHistogramBin(uint32_t aLatencyUs, uint8_t aBinCount)
+{
+    uint8_t bin = 0;
+
+    if (aLatencyUs > 1)
+    {
+        bin = (uint8_t)(31 - __builtin_clz(aLatencyUs));
+    }
+
+    return (bin < aBinCount) ? bin : (uint8_t)(aBinCount - 1);
+}
+
 /**
  * This function performs all platform-specific initialization of
  * OpenThread's drivers.
@@ -136,6 +163,39 @@ void efr32LogInit(void);
  */
 void efr32LogDeinit(void);
 
+/**
+ * Counters of the deferred log ring.
+ *
+ */
+typedef struct efr32LogRingCounters
+{
+    uint32_t mDroppedOldest; ///< Records discarded to make room for newer ones.
+    uint32_t mDroppedNewest; ///< Records discarded because the ring was full or too small for them.
+    uint32_t mHighWatermark; ///< Maximum number of bytes used in the ring.
+} efr32LogRingCounters;
+
+/**
+ * Writes the records queued in the deferred log ring to the log transport.
+ *
+ * Called from the main loop when SL_OPENTHREAD_DEFERRED_LOG_ENABLE is set.
+ *
+ */
+void efr32LogProcess(void);
+
+/**
+ * Indicates whether records are queued in the deferred log ring.
+ *
+ */
+bool efr32LogIsPending(void);
+
+/**
+ * Get the counters of the deferred log ring.
+ *
+ * @param[out]  aCounters  A pointer to the counters to fill.
+ *
+ */
+void efr32LogGetRingCounters(efr32LogRingCounters *aCounters);
+
 /**
  * Print reset info.
  *
@@ -179,8 +239,322 @@ bool efr32AllowSleepCallback(void);
  */
 otError efr32RadioLoadChannelConfig(uint8_t aChannel, int8_t aTxPower);
 
+/**
+ * Forget the transmit power last written to RAIL by the power manager, so that the next one is written again.
+ *
+ * Must be called whenever the RAIL transmit power is changed or reconfigured outside of the power manager.
+ *
+ */
+void sli_invalidate_tx_power_in_rail(void);
+
 otError railStatusToOtError(sl_rail_status_t status);
 
+/**
+ * Start an energy sweep, see otPlatRadioExtensionStartEnergySweep().
+ *
+ */
+otError efr32RadioStartEnergySweep(uint32_t aChannelMask, uint16_t aDwellTimeMs);
+
+/**
+ * Get the results of the last energy sweep, see otPlatRadioExtensionGetEnergySweepResults().
+ *
+ */
+otError efr32RadioGetEnergySweepResults(efr32EnergySweepResult *aResults, uint8_t *aNumEntries);
+
+/**
+ * Set the sampling interval of the noise floor monitor, see otPlatRadioExtensionSetNoiseFloorMonitorInterval().
+ *
+ */
+otError efr32RadioSetNoiseFloorMonitorInterval(uint32_t aIntervalUs);
+
+/**
+ * Get the noise floor monitor statistics, see otPlatRadioExtensionGetNoiseFloorStats().
+ *
+ */
+otError efr32RadioGetNoiseFloorStats(efr32NoiseFloorStats *aStats);
+
+/**
+ * Clear the noise floor monitor statistics, see otPlatRadioExtensionClearNoiseFloorStats().
+ *
+ */
+otError efr32RadioClearNoiseFloorStats(void);
+
+/**
+ * Get the coex request to grant latency histograms, see otPlatRadioExtensionGetCoexLatencyHistograms().
+ *
+ */
+otError efr32RadioGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                           efr32CoexLatencyHistogram *aRxHistogram);
+
+/**
+ * Get the most recent coex events, see otPlatRadioExtensionGetCoexEvents().
+ *
+ */
+otError efr32RadioGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents);
+
+/**
+ * Get the most recent entries of the radio trace, see otPlatRadioExtensionGetRadioTrace().
+ *
+ */
+otError efr32RadioGetRadioTrace(efr32RadioTraceEntry *aEntries, uint16_t *aNumEntries, uint32_t *aTotalEntries);
+
+/**
+ * Clear the radio trace, see otPlatRadioExtensionClearRadioTrace().
+ *
+ */
+otError efr32RadioClearRadioTrace(void);
+
+/**
+ * Get the transmit statistics of an interface, see otPlatRadioExtensionGetTxStats().
+ *
+ */
+otError efr32RadioGetTxStats(uint8_t aIid, efr32TxStats *aStats);
+
+/**
+ * Clear the transmit statistics, see otPlatRadioExtensionClearTxStats().
+ *
+ */
+otError efr32RadioClearTxStats(void);
+
+/**
+ * Enable or disable the adaptive CCA threshold, see otPlatRadioExtensionSetAdaptiveCcaEnabled().
+ *
+ */
+otError efr32RadioSetAdaptiveCcaEnabled(bool aEnabled);
+
+/**
+ * Get the adaptive CCA threshold counters, see otPlatRadioExtensionGetAdaptiveCcaCounters().
+ *
+ */
+otError efr32RadioGetAdaptiveCcaCounters(efr32AdaptiveCcaCounters *aCounters);
+
+/**
+ * Clear the adaptive CCA threshold counters, see otPlatRadioExtensionClearAdaptiveCcaCounters().
+ *
+ */
+otError efr32RadioClearAdaptiveCcaCounters(void);
+
+/**
+ * Take a snapshot of the radio counters, see otPlatRadioExtensionGetRadioCountersSnapshot().
+ *
+ */
+otError efr32RadioGetRadioCountersSnapshot(efr32RadioCountersSnapshot *aSnapshot);
+
+/**
+ * Get the radio activity since a previous snapshot, see otPlatRadioExtensionGetRadioCountersDelta().
+ *
+ */
+otError efr32RadioGetRadioCountersDelta(efr32RadioCountersSnapshot *aPrevious, efr32RadioCountersSnapshot *aDelta);
+
+/**
+ * Get the radio state residency, see otPlatRadioExtensionGetRadioResidency().
+ *
+ */
+otError efr32RadioGetRadioResidency(efr32RadioResidency *aResidency);
+
+/**
+ * Get the radio residency as radio time statistics, see otPlatRadioExtensionGetRadioTimeStats().
+ *
+ */
+otError efr32RadioGetRadioTimeStats(otRadioTimeStats *aStats);
+
+/**
+ * Clear the radio state residency, see otPlatRadioExtensionClearRadioResidency().
+ *
+ */
+otError efr32RadioClearRadioResidency(void);
+
+/**
+ * Get the radio reconfiguration counters, see otPlatRadioExtensionGetRadioReconfigCounters().
+ *
+ */
+otError efr32RadioGetRadioReconfigCounters(efr32RadioReconfigCounters *aCounters);
+
+/**
+ * Clear the radio reconfiguration counters, see otPlatRadioExtensionClearRadioReconfigCounters().
+ *
+ */
+otError efr32RadioClearRadioReconfigCounters(void);
+
+/**
+ * Get the CSL clock drift learned against the parent, see otPlatRadioExtensionGetCslDriftEstimate().
+ *
+ */
+otError efr32RadioGetCslDriftEstimate(efr32CslDriftEstimate *aEstimate);
+
+/**
+ * Queue scheduled receive windows, see otPlatRadioExtensionScheduleRxWindows().
+ *
+ */
+otError efr32RadioScheduleRxWindows(const efr32RxWindow *aWindows, uint8_t aCount);
+
+/**
+ * Get the scheduled receive window counters, see otPlatRadioExtensionGetScheduledRxStats().
+ *
+ */
+otError efr32RadioGetScheduledRxStats(efr32ScheduledRxStats *aStats);
+
+/**
+ * Send a Green Power response buffered on behalf of a host, without CSMA.
+ *
+ * The radio is left free until shortly before @p aTxTime, the response is then started from the main loop and
+ * scheduled by RAIL to start at @p aTxTime, or sent right away when that time has passed. If the radio is busy
+ * then, the response waits for it until @p aWindowUs after @p aTxTime. The completion is reported with
+ * sl_gp_intf_tx_done(), not to the host.
+ *
+ * @param[in]  aInstance  The OpenThread instance of the host which buffered the response.
+ * @param[in]  aPsdu      The PSDU of the response, copied before returning.
+ * @param[in]  aLength    The length of the PSDU, including the FCS.
+ * @param[in]  aChannel   The channel to send the response on.
+ * @param[in]  aTxTime    The RAIL time to start the transmission at, in microseconds.
+ * @param[in]  aWindowUs  The time after @p aTxTime the transmission may still start at, in microseconds.
+ *
+ * @retval OT_ERROR_NONE   The transmission is started, or armed to start at @p aTxTime.
+ * @retval OT_ERROR_BUSY   Another response is pending, try again once sl_gp_intf_tx_done() reports it.
+ *
+ */
+otError efr32RadioTransmitGpFrame(otInstance    *aInstance,
+                                  const uint8_t *aPsdu,
+                                  uint8_t        aLength,
+                                  uint8_t        aChannel,
+                                  uint32_t       aTxTime,
+                                  uint32_t       aWindowUs);
+
+/**
+ * Start a sniffer capture, see otPlatRadioExtensionStartSnifferCapture().
+ *
+ */
+otError efr32RadioStartSnifferCapture(const uint8_t *aChannels, uint8_t aNumChannels);
+
+/**
+ * Stop the sniffer capture, see otPlatRadioExtensionStopSnifferCapture().
+ *
+ */
+otError efr32RadioStopSnifferCapture(void);
+
+/**
+ * Read a batch of captured frames, see otPlatRadioExtensionReadSnifferCapture().
+ *
+ */
+otError efr32RadioReadSnifferCapture(uint8_t *aBuffer, uint16_t aBufferLength, uint16_t *aBatchLength);
+
+/**
+ * Get the sniffer capture counters, see otPlatRadioExtensionGetSnifferCaptureCounters().
+ *
+ */
+otError efr32RadioGetSnifferCaptureCounters(efr32SnifferCaptureCounters *aCounters);
+
+/**
+ * Send a frame of the diag PER test, without CSMA.
+ *
+ * The completion is reported with efr32DiagTxDone(), not to the stack.
+ *
+ * @param[in]  aInstance  The OpenThread instance running the diag.
+ * @param[in]  aPsdu      The PSDU of the frame, copied before returning.
+ * @param[in]  aLength    The length of the PSDU, including the FCS.
+ * @param[in]  aChannel   The channel to send the frame on.
+ * @param[in]  aTxPower   The transmit power, in dBm.
+ *
+ * @retval OT_ERROR_NONE   The transmission is started.
+ * @retval OT_ERROR_BUSY   The radio is transmitting or scanning, try again later.
+ *
+ */
+otError efr32RadioTransmitDiagFrame(otInstance    *aInstance,
+                                    const uint8_t *aPsdu,
+                                    uint8_t        aLength,
+                                    uint8_t        aChannel,
+                                    int8_t         aTxPower);
+
+/**
+ * Enable or disable the counting of the frames received with a CRC error, and clear the count.
+ *
+ * @param[in]  aEnable  TRUE to count the frames received with a CRC error, FALSE to stop.
+ *
+ */
+void efr32RadioSetRxFrameErrorCount(bool aEnable);
+
+/**
+ * Get the number of frames received with a CRC error since efr32RadioSetRxFrameErrorCount() enabled the count.
+ *
+ */
+uint32_t efr32RadioGetRxFrameErrorCount(void);
+
+/**
+ * This callback is called by the radio when a frame sent with efr32RadioTransmitDiagFrame() is done.
+ *
+ * @param[in]  aError  The transmit status, as for otPlatRadioTxDone().
+ *
+ */
+void efr32DiagTxDone(otError aError);
+
+/**
+ * Sends the next frame of the diag PER test once its timer expired.
+ *
+ * Called from the main loop when OPENTHREAD_CONFIG_DIAG_ENABLE is set.
+ *
+ */
+void efr32DiagProcess(void);
+
+/**
+ * Code paths of the radio whose CPU cycles are accounted when SL_OPENTHREAD_RADIO_BENCH_ENABLE is set.
+ *
+ */
+typedef enum efr32RadioBenchPathId
+{
+    EFR32_RADIO_BENCH_RAIL_CALLBACK = 0, ///< RAIL event callback, the receive and ACK paths included.
+    EFR32_RADIO_BENCH_RX_ISR        = 1, ///< Queueing of a received frame, in the RAIL callback.
+    EFR32_RADIO_BENCH_RX_DELIVERY   = 2, ///< Delivery of a queued frame to the stack, in the main loop.
+    EFR32_RADIO_BENCH_ACK           = 3, ///< Frame pending lookup and Enh-ACK generation, in the RAIL callback.
+    EFR32_RADIO_BENCH_TX_START      = 4, ///< Loading and starting a transmission.
+    EFR32_RADIO_BENCH_TX_DONE       = 5, ///< Completion of a transmission, before it is reported.
+    EFR32_RADIO_BENCH_PATH_COUNT    = 6, ///< Number of accounted paths.
+} efr32RadioBenchPathId;
+
+/**
+ * CPU cycles spent in a radio code path, measured with the DWT cycle counter.
+ *
+ * A path interrupted by the RAIL callback is accounted the cycles of the callback too.
+ *
+ */
+typedef struct efr32RadioBenchPath
+{
+    uint32_t mCount;     ///< Number of runs of the path.
+    uint32_t mMaxCycles; ///< Longest run of the path, in CPU cycles.
+    uint64_t mCycles;    ///< CPU cycles spent in the path.
+} efr32RadioBenchPath;
+
+/**
+ * Counters of the radio benchmark.
+ *
+ */
+typedef struct efr32RadioBenchCounters
+{
+    efr32RadioBenchPath mPaths[EFR32_RADIO_BENCH_PATH_COUNT]; ///< Paths, indexed by efr32RadioBenchPathId.
+    uint32_t            mRxDropped;   ///< Received frames dropped, for lack of buffers or as malformed.
+    uint32_t            mRxOverflows; ///< Receive FIFO overflows.
+} efr32RadioBenchCounters;
+
+/**
+ * Clear the radio benchmark counters, and start the DWT cycle counter.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the counters.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_BENCH_ENABLE is not set.
+ *
+ */
+otError efr32RadioResetBenchCounters(void);
+
+/**
+ * Get the radio benchmark counters.
+ *
+ * @param[out]  aCounters  A pointer to the counters to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully read the counters.
+ * @retval OT_ERROR_INVALID_ARGS     @p aCounters is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_BENCH_ENABLE is not set.
+ *
+ */
+otError efr32RadioGetBenchCounters(efr32RadioBenchCounters *aCounters);
+
 /**
  * This function performs Serial processing.
  *
@@ -33,6 +33,7 @@
  */
 
 #include <assert.h>
+#include <stddef.h>
 #include <openthread-core-config.h>
 #include <openthread-system.h>
 #include <openthread/link.h>
@@ -65,12 +66,15 @@
 #include "radio_coex.h"
 #include "radio_multi_channel.h"
 #include "radio_power_manager.h"
+#include "radio_trace.h"
 #include "rail_config.h"
 #include "sl_memory_manager.h"
 #include "sl_multipan.h"
 #include "sl_packet_utils.h"
+#include "sl_radio_extension.h"
 #include "sl_rail.h"
 #include "sl_rail_ieee802154.h"
+#include "sniffer_capture.h"
 #include "soft_source_match_table.h"
 
 #include "pa_conversions_efr32.h"
@@ -108,6 +112,8 @@
 #include "sl_rail_util_ieee802154_fast_channel_switching_config.h"
 #endif // SL_CATALOG_RAIL_UTIL_IEEE802154_FAST_CHANNEL_SWITCHING_PRESENT
 
+#include "logging_plat.h"
+
 //------------------------------------------------------------------------------
 // Enums, macros and static variables
 
@@ -236,7 +242,8 @@ typedef enum
 typedef enum
 {
     ENERGY_SCAN_MODE_SYNC,
-    ENERGY_SCAN_MODE_ASYNC
+    ENERGY_SCAN_MODE_ASYNC,
+    ENERGY_SCAN_MODE_SWEEP
 } energyScanMode;
 
 typedef struct
@@ -246,6 +253,7 @@ typedef struct
     uint8_t        lqi;
     int8_t         rssi;
     uint8_t        iid;
+    bool           scheduledRx; // Received in a scheduled receive window.
     sl_rail_time_t timestamp;
 } rxPacketDetails;
 
@@ -263,6 +271,36 @@ static energyScanMode            sEnergyScanMode;
 // To track active interface the energy scan is being performed.
 static uint8_t sEnergyScanActiveInterface = INVALID_INTERFACE_INDEX;
 
+// Energy Sweep
+static uint32_t               sEnergySweepChannelMask; // Channels left to scan in the current sweep.
+static uint8_t                sEnergySweepChannel;     // Channel currently scanned.
+static bool                   sEnergySweepResumeRx;
+static int8_t                 sEnergySweepMax;
+static int64_t                sEnergySweepSum;
+static uint32_t               sEnergySweepSampleCount;
+static uint32_t               sEnergySweepHistogram[EFR32_RSSI_HISTOGRAM_BIN_COUNT];
+static efr32EnergySweepResult sEnergySweepResults[EFR32_ENERGY_SWEEP_MAX_CHANNELS];
+static uint8_t                sEnergySweepResultCount;
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+// Adaptive CCA threshold
+static bool                     sAdaptiveCcaEnabled = false;
+static efr32AdaptiveCcaCounters sAdaptiveCcaCounters;
+static uint16_t                 sAdaptiveCcaWindowTxCount;
+static uint16_t                 sAdaptiveCcaWindowCcaFailCount;
+static uint16_t                 sAdaptiveCcaWindowNoAckCount;
+#endif
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+// Background noise floor monitor
+static sl_rail_multi_timer_t sNoiseFloorTimer;
+static uint32_t              sNoiseFloorIntervalUs = SL_OPENTHREAD_NOISE_FLOOR_MONITOR_INTERVAL_US;
+static bool                  sNoiseFloorListening; // Background receive selected by radioSetRx().
+static efr32NoiseFloorStats  sNoiseFloorStats;
+static uint16_t              sNoiseFloorWindowCount;     // Samples in the rolling window.
+static uint16_t              sNoiseFloorWindowBusyCount; // Busy samples in the rolling window.
+#endif
+
 static bool sIsSrcMatchEnabled = false;
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
@@ -280,6 +318,8 @@ typedef struct
     otRadioFrame frame;
     uint8_t      iid;
     uint8_t      currentRadioTxPriority;
+    bool         txAtStartTime; // Sent without CCA at txStartTime, rather than as set by mTxInfo.
+    uint32_t     txStartTime;   // RAIL time the SHR starts at.
 } radioFrame;
 
 // Receive
@@ -301,6 +341,29 @@ static uint8_t      sLastLqi         = 0;
 static int8_t       sLastRssi        = 0;
 static otExtAddress sExtAddress[RADIO_EXT_ADDR_COUNT];
 
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+// Green Power responses are sent from a buffer of their own, the frames buffered by the hosts are kept by
+// sl_gp_interface.c. The radio is left to the hosts until shortly before the response is due.
+#define GP_TRANSMIT_LEAD_TIME_US 2000 // Time given to the main loop to start the response before it is due.
+
+static radioFrame            sGpTransmitBuffer;
+static uint8_t               sGpTransmitPsdu[IEEE802154_MAX_LENGTH];
+static sl_rail_multi_timer_t sGpTransmitTimer;
+static int8_t                sGpTransmitPower;
+static uint32_t              sGpTransmitDeadline; // Latest RAIL time the response may start at.
+static volatile bool         sGpTransmitArmed;    // The response waits for sGpTransmitTimer.
+static volatile bool         sGpTransmitDue;      // The response is to be started from the main loop.
+#endif
+
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+// Frames of the diag PER test are sent from a buffer of their own and reported to efr32DiagTxDone() (see diag.c).
+static radioFrame sDiagTransmitBuffer;
+static uint8_t    sDiagTransmitPsdu[IEEE802154_MAX_LENGTH];
+
+// Frames received with a CRC error, while efr32RadioSetRxFrameErrorCount() has the event enabled.
+static volatile uint32_t sRxFrameErrorCount;
+#endif
+
 // CSMA config: Should be globally scoped
 #define CSL_CSMA_BACKOFF_TIME_IN_US 150
 sl_rail_csma_config_t csmaConfig    = SL_RAIL_CSMA_CONFIG_802_15_4_2003_2P4_GHZ_OQPSK_CSMA;
@@ -319,10 +382,13 @@ static otRadioIeInfo sTransmitIeInfo[RADIO_REQUEST_BUFFER_COUNT];
 #define UNINITIALIZED_CHANNEL 0xFF
 
 static bool              sPromiscuous = false;
+static volatile bool     sSnifferCaptureActive;
 static efr32CommonConfig sCommonConfig;
 static efr32BandConfig   sBandConfig;
 static efr32BandConfig  *sCurrentBandConfig = NULL;
 
+efr32RadioReconfigCounters gRadioReconfigCounters;
+
 static int8_t sCcaThresholdDbm = CCA_THRESHOLD_DEFAULT;
 
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
@@ -361,11 +427,14 @@ typedef struct
     } request;
     // The pending command type.
     pendingCommandType cmdType : 2;
-    // The interface iid of the pending command.
-    uint8_t iid : 2;
 } pendingCommandEntry;
 
-static Queue_t sPendingCommandQueue;
+// A host only requests one command at a time, so each interface has a single pending command slot.
+static pendingCommandEntry sPendingCommands[RADIO_INTERFACE_COUNT];
+// Bit N is set when interface N has a pending command.
+static uint8_t sPendingCommandMask;
+// Interface served last, the round robin resumes after it.
+static uint8_t sPendingCommandLastIid;
 
 extern otInstance *sInstances[OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_NUM];
 static uint8_t     sRailFilterMask = RADIO_BCAST_PANID_FILTER_MASK;
@@ -426,6 +495,15 @@ static uint8_t fastChannelIndex(uint8_t aChannel)
 
 static void efr32ScanTimerHandler(struct sl_rail_multi_timer *tmr, sl_rail_time_t expectedTimeOfEvent, void *cbArg);
 static sl_rail_status_t efr32ScanDwell(uint16_t symbols);
+static void             setCcaThreshold(void);
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+static void noiseFloorArmTimer(void);
+static void noiseFloorStart(void);
+static void noiseFloorStop(void);
+#endif
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+static void gpTransmitProcess(void);
+#endif
 
 // RAIL
 
@@ -486,7 +564,32 @@ static const sl_rail_ieee802154_config_t sRailIeee802154Config = {
 #define SHR_SIZE 5 // 4 bytes of preamble, 1 byte sync-word
 #endif
 
-#define SHR_DURATION_US 160 // Duration of SHR in us.
+// PHY timings of the loaded band, rebuilt by efr32PhyTimingUpdate() whenever a band configuration is loaded so
+// that the scan, transmit and Enh-ACK paths only use integer arithmetic. Durations of a symbol and of an octet are
+// kept in fixed point with EFR32_PHY_TIMING_FRACTION_BITS fractional bits, as they are not whole microseconds on
+// every PHY.
+#define EFR32_PHY_TIMING_FRACTION_BITS 8
+#define EFR32_PHY_TIMING_ACK_WAIT_SYMBOLS 12 // Time waited for an ACK, in symbols.
+
+typedef struct efr32PhyTiming
+{
+    uint32_t mSymbolTimeUsFp;    // Duration of a symbol, fixed point.
+    uint32_t mByteTimeUsFp;      // Duration of an octet, fixed point.
+    uint16_t mSymbolTimeUs;      // Duration of a symbol, rounded, at least 1.
+    uint16_t mShrDurationUs;     // Duration of the SHR (preamble and SFD).
+    uint16_t mPhrDurationUs;     // Duration of the PHR.
+    uint16_t mAckWaitUs;         // Time waited for an ACK after a frame requesting one.
+    uint16_t mCsmaOverheadUs;    // Time budgeted for CSMA/CA.
+    uint16_t mEnhAckShrOffsetUs; // PHR of a received frame, rx to tx turnaround, then PHR and SHR of its Enh-ACK.
+} efr32PhyTiming;
+
+static efr32PhyTiming sPhyTiming;
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline uint32_t efr32PhyBytesToUs(uint32_t aBytes)
+{
+    return (aBytes * sPhyTiming.mByteTimeUsFp) >> EFR32_PHY_TIMING_FRACTION_BITS;
+}
 
 // Misc
 static volatile uint32_t miscRadioState = 0;
@@ -525,20 +628,6 @@ static bool rxPacketQueueOverflowCallback(const Queue_t *queue, void *data)
     return false;
 }
 
-#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-static bool pendingCommandQueueOverflowCallback(const Queue_t *queue, void *data)
-{
-    OT_UNUSED_VARIABLE(queue);
-    OT_UNUSED_VARIABLE(data);
-
-    // We should never hit this callback because a host can only request
-    // one command at a time. Hence, added a assert if it happens.
-    OT_ASSERT(false);
-
-    return false;
-}
-#endif
-
 #if RADIO_CONFIG_ENABLE_CUSTOM_EUI_SUPPORT && defined(_SILICON_LABS_32B_SERIES_2)
 /*
  * This API reads the UserData page on the given EFR device.
@@ -682,6 +771,22 @@ static securityMaterial sMacKeys[RADIO_INTERFACE_COUNT];
 static uint32_t sCslPeriod;
 static uint32_t sCslSampleTime;
 
+#if SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+// Clock drift learned against the parent. The parent schedules its CSL transmissions from the phase last
+// reported in one of our frames, so the offset from our sample time of a frame received in a CSL window,
+// divided by the time elapsed since that report, bounds the drift between both clocks. It also includes the
+// transmit uncertainty of the parent, which keeps the estimate conservative.
+#define CSL_DRIFT_FRACTION_BITS 8
+#define CSL_DRIFT_DECAY_SHIFT 3
+
+static uint32_t       sCslDriftSyncTime;    // SHR time of the last frame reporting our CSL phase, 0 if none.
+static uint32_t       sCslDriftPpmFp;       // Learned drift in ppm, fixed point.
+static uint32_t       sCslDriftSampleCount; // Number of frames used for the estimate.
+static uint32_t       sCslDriftSampleTime;  // Time of the last frame used for the estimate, in milliseconds.
+static otShortAddress sCslDriftParentShort;
+static otExtAddress   sCslDriftParent;
+#endif
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
 static uint16_t getCslPhase(uint32_t shrTxTime)
 {
@@ -695,8 +800,107 @@ static uint16_t getCslPhase(uint32_t shrTxTime)
 
     diff = ((sCslSampleTime % cslPeriodInUs) - (shrTxTime % cslPeriodInUs) + cslPeriodInUs) % cslPeriodInUs;
 
+#if SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+    sCslDriftSyncTime = shrTxTime;
+#endif
+
     return (uint16_t)(diff / OT_US_PER_TEN_SYMBOLS);
 }
+
+#if SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+static void cslDriftReset(void)
+{
+    sCslDriftSyncTime    = 0;
+    sCslDriftPpmFp       = 0;
+    sCslDriftSampleCount = 0;
+}
+
+static bool cslDriftIsFromParent(const otRadioFrame *aFrame)
+{
+    otMacAddress srcAddress;
+    bool         isFromParent = false;
+
+    otEXPECT(otMacFrameGetSrcAddr(aFrame, &srcAddress) == OT_ERROR_NONE);
+
+    switch (srcAddress.mType)
+    {
+    case OT_MAC_ADDRESS_TYPE_SHORT:
+        isFromParent = (srcAddress.mAddress.mShortAddress == sCslDriftParentShort);
+        break;
+
+    case OT_MAC_ADDRESS_TYPE_EXTENDED:
+        isFromParent = (memcmp(&srcAddress.mAddress.mExtAddress, &sCslDriftParent, sizeof(otExtAddress)) == 0);
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return isFromParent;
+}
+
+// Called for the frames received in a scheduled receive window, with the time of the end of their SHR. Only the
+// frames of the parent are used, the others are not scheduled from our CSL phase.
+static void cslDriftOnScheduledRx(const otRadioFrame *aFrame, uint32_t aRxTime)
+{
+    uint32_t cslPeriodInUs = sCslPeriod * OT_US_PER_TEN_SYMBOLS;
+    uint32_t elapsed       = aRxTime - sCslDriftSyncTime;
+    uint32_t offset;
+    uint32_t sampleFp;
+
+    otEXPECT((cslPeriodInUs > 0) && (sCslDriftSyncTime != 0));
+    otEXPECT(elapsed >= SL_OPENTHREAD_CSL_DRIFT_MIN_INTERVAL_MS * 1000UL);
+    otEXPECT(cslDriftIsFromParent(aFrame));
+
+    // The CSL phase is reported from the transmit time of the frame plus the SHR duration (see
+    // updateIeInfoTxFrame()), the parent aims the end of the SHR of its frames at the sample time less the SHR
+    // duration. That constant is removed so that only the drift remains in the offset.
+    aRxTime += sPhyTiming.mShrDurationUs;
+
+    // Offset of the frame from the closest sample time, in either direction.
+    offset = ((aRxTime % cslPeriodInUs) - (sCslSampleTime % cslPeriodInUs) + cslPeriodInUs) % cslPeriodInUs;
+    if (offset > cslPeriodInUs / 2)
+    {
+        offset = cslPeriodInUs - offset;
+    }
+
+    sampleFp = (uint32_t)((((uint64_t)offset * 1000000U) << CSL_DRIFT_FRACTION_BITS) / elapsed);
+
+    // Follow a higher drift at once, decay slowly towards a lower one.
+    if (sampleFp >= sCslDriftPpmFp)
+    {
+        sCslDriftPpmFp = sampleFp;
+    }
+    else
+    {
+        sCslDriftPpmFp -= (sCslDriftPpmFp - sampleFp) >> CSL_DRIFT_DECAY_SHIFT;
+    }
+
+    sCslDriftSampleCount++;
+    sCslDriftSampleTime = otPlatAlarmMilliGetNow();
+
+exit:
+    return;
+}
+
+static uint8_t cslDriftGetAccuracy(uint8_t aXtalAccuracy)
+{
+    uint32_t accuracy = aXtalAccuracy;
+
+    // Frames no longer landing in the windows do not produce samples, a stale estimate is not trusted so that
+    // the windows widen back instead of staying too narrow.
+    if ((sCslDriftSampleCount >= SL_OPENTHREAD_CSL_DRIFT_MIN_SAMPLES)
+        && ((otPlatAlarmMilliGetNow() - sCslDriftSampleTime) < SL_OPENTHREAD_CSL_DRIFT_MAX_SAMPLE_AGE_MS))
+    {
+        accuracy = ((sCslDriftPpmFp + (1U << CSL_DRIFT_FRACTION_BITS) - 1) >> CSL_DRIFT_FRACTION_BITS)
+                   + SL_OPENTHREAD_CSL_DRIFT_MARGIN_PPM;
+        accuracy = (accuracy < aXtalAccuracy) ? accuracy : aXtalAccuracy;
+    }
+
+    return (uint8_t)accuracy;
+}
+#endif // SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
 #endif // OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 
 // Enhanced ACK IE data
@@ -867,6 +1071,8 @@ static bool validatePacketDetails(sl_rail_rx_packet_handle_t   packetHandle,
                                   uint16_t                    *packetLength);
 static bool validatePacketTimestamp(sl_rail_rx_packet_details_t *pPacketDetails, uint16_t packetLength);
 
+static uint64_t railTimeToPlatTime(sl_rail_time_t aTimestamp);
+
 static void updateRxFrameTimestamp(bool aIsAckFrame, sl_rail_time_t aTimestamp);
 
 static otError skipRxPacketLengthBytes(sl_rail_rx_packet_info_t *pPacketInfo);
@@ -934,6 +1140,92 @@ static void updateEvents(sl_rail_events_t mask, sl_rail_events_t values)
 #define handlePhyStackEvent(event, supplement) 0
 #endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
 
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+// Flags which move the radio in or out of a transient state, see residencyUpdate().
+#define RESIDENCY_FLAGS (FLAG_RADIO_INIT_DONE | FLAG_ONGOING_TX_DATA | FLAG_ONGOING_TX_ACK | EVENT_SCHEDULED_RX_STARTED)
+
+static uint64_t sResidencyTimeUs[EFR32_RADIO_RESIDENCY_STATE_COUNT];
+static uint64_t sResidencyStateStart;
+static uint32_t sResidencyTransitionCount;
+static uint8_t  sResidencyState     = EFR32_RADIO_RESIDENCY_STATE_COUNT; // Not tracked before the radio init.
+static uint8_t  sResidencyBaseState = EFR32_RADIO_RESIDENCY_SLEEP;       // Sleep or background receive.
+
+// Adds the time spent in the current state up to aNow. Must be called with interrupts disabled.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void residencyAccount(uint64_t aNow)
+{
+    if (sResidencyState < EFR32_RADIO_RESIDENCY_STATE_COUNT)
+    {
+        sResidencyTimeUs[sResidencyState] += aNow - sResidencyStateStart;
+    }
+
+    sResidencyStateStart = aNow;
+}
+
+// Transient states (energy scan, ACK transmit, transmit, scheduled receive window) take precedence over the
+// background state selected by radioSetRx() and radioSetIdle(). Must be called with interrupts disabled.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void residencyUpdateLocked(void)
+{
+    uint8_t state = sResidencyBaseState;
+
+    if ((miscRadioState & FLAG_RADIO_INIT_DONE) == 0)
+    {
+        state = EFR32_RADIO_RESIDENCY_STATE_COUNT;
+    }
+    else if (sEnergyScanStatus == ENERGY_SCAN_STATUS_IN_PROGRESS)
+    {
+        state = EFR32_RADIO_RESIDENCY_ENERGY_SCAN;
+    }
+    else if (miscRadioState & FLAG_ONGOING_TX_ACK)
+    {
+        state = EFR32_RADIO_RESIDENCY_ACK_TX;
+    }
+    else if (miscRadioState & FLAG_ONGOING_TX_DATA)
+    {
+        state = EFR32_RADIO_RESIDENCY_TX;
+    }
+    else if (miscRadioState & EVENT_SCHEDULED_RX_STARTED)
+    {
+        state = EFR32_RADIO_RESIDENCY_SCHEDULED_RX;
+    }
+
+    otEXPECT(state != sResidencyState);
+
+    residencyAccount(otPlatTimeGet());
+    sResidencyState = state;
+    sResidencyTransitionCount++;
+
+exit:
+    return;
+}
+#endif // SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void residencyUpdate(void)
+{
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    residencyUpdateLocked();
+    CORE_EXIT_ATOMIC();
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void residencySetBaseState(uint8_t aState)
+{
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    sResidencyBaseState = aState;
+    residencyUpdateLocked();
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aState);
+#endif
+}
+
 // Set or clear the passed flag.
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
 static inline void setInternalFlag(uint32_t flag, bool val)
@@ -941,6 +1233,12 @@ static inline void setInternalFlag(uint32_t flag, bool val)
     CORE_DECLARE_IRQ_STATE;
     CORE_ENTER_ATOMIC();
     miscRadioState = (val ? (miscRadioState | flag) : (miscRadioState & ~flag));
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+    if (flag & RESIDENCY_FLAGS)
+    {
+        residencyUpdateLocked();
+    }
+#endif
     CORE_EXIT_ATOMIC();
 }
 // Returns true if the passed flag is set, false otherwise.
@@ -996,6 +1294,10 @@ static void radioSetIdle(void)
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_IDLED, 0U);
     }
     sl_rail_yield_radio(gRailHandle);
+    residencySetBaseState(EFR32_RADIO_RESIDENCY_SLEEP);
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    noiseFloorStop();
+#endif
 }
 
 static otError radioSetRx(uint8_t aChannel)
@@ -1034,6 +1336,10 @@ static otError radioSetRx(uint8_t aChannel)
     otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
 
     (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_LISTEN, 0U);
+    residencySetBaseState(EFR32_RADIO_RESIDENCY_RX);
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    noiseFloorStart();
+#endif
 
     otLogInfoPlat("State=OT_RADIO_STATE_RECEIVE");
 exit:
@@ -1074,6 +1380,167 @@ static otError radioScheduleRx(uint8_t aChannel, uint32_t aStart, uint32_t aDura
 exit:
     return error;
 }
+
+//------------------------------------------------------------------------------
+// Scheduled receive windows
+
+// Pending receive windows, ordered by start time. The first one is armed in RAIL while FLAG_SCHEDULED_RX_PENDING
+// is set, the next one is armed from the main loop once it ends. A transmission takes precedence over a window,
+// which is armed again for its remaining time once the radio is free. Only the main loop updates the queue.
+static efr32RxWindow         sRxWindows[SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE];
+static uint8_t               sRxWindowCount;
+static bool                  sRxWindowHeadArmed; // The first window was armed at least once.
+static volatile bool         sRxWindowEnded;     // RAIL reported the end of the armed window.
+static otInstance           *sRxWindowInstance;  // Instance whose transmit power applies to the ACKs.
+static efr32ScheduledRxStats sRxWindowStats;
+
+static inline uint32_t rxWindowEnd(const efr32RxWindow *aWindow)
+{
+    return aWindow->mStart + aWindow->mDuration;
+}
+
+static void rxWindowRemoveHead(void)
+{
+    sRxWindowCount--;
+    memmove(&sRxWindows[0], &sRxWindows[1], sRxWindowCount * sizeof(sRxWindows[0]));
+    sRxWindowHeadArmed = false;
+    sRxWindowEnded     = false;
+}
+
+static void rxWindowFlush(void)
+{
+    sRxWindowCount     = 0;
+    sRxWindowHeadArmed = false;
+    sRxWindowEnded     = false;
+}
+
+static otError rxWindowInsert(const efr32RxWindow *aWindow)
+{
+    otError error    = OT_ERROR_NONE;
+    uint8_t position = sRxWindowCount;
+
+    for (uint8_t i = 0; i < sRxWindowCount; i++)
+    {
+        const efr32RxWindow *window = &sRxWindows[i];
+
+        // A window requested again while still pending, or covered by a pending one, is not queued twice.
+        if ((window->mChannel == aWindow->mChannel) && ((int32_t)(aWindow->mStart - window->mStart) >= 0)
+            && ((int32_t)(rxWindowEnd(aWindow) - rxWindowEnd(window)) <= 0))
+        {
+            sRxWindowStats.mMerged++;
+            ExitNow();
+        }
+
+        if ((position == sRxWindowCount) && ((int32_t)(aWindow->mStart - window->mStart) < 0))
+        {
+            position = i;
+        }
+    }
+
+    otEXPECT_ACTION(sRxWindowCount < SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE, error = OT_ERROR_NO_BUFS);
+
+    if ((position == 0) && getInternalFlag(FLAG_SCHEDULED_RX_PENDING))
+    {
+        if (getInternalFlag(EVENT_SCHEDULED_RX_STARTED))
+        {
+            // The window in progress is not cut short, the new one follows it.
+            position = 1;
+        }
+        else
+        {
+            // The new window starts first, the armed one is armed again after it.
+            sl_rail_idle(gRailHandle, SL_RAIL_IDLE, true);
+            setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false);
+            sRxWindowHeadArmed = false;
+        }
+    }
+
+    if ((position == 0) && (sRxWindowCount > 0))
+    {
+        sRxWindowHeadArmed = false;
+        sRxWindowEnded     = false;
+    }
+
+    memmove(&sRxWindows[position + 1], &sRxWindows[position], (sRxWindowCount - position) * sizeof(sRxWindows[0]));
+    sRxWindows[position] = *aWindow;
+    sRxWindowCount++;
+    sRxWindowStats.mQueued++;
+
+exit:
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        sRxWindowStats.mRejected++;
+    }
+    return error;
+}
+
+// Arms the first pending window once the radio is free, after dropping the windows which ended in the meantime.
+static void rxWindowProcess(void)
+{
+    efr32RxWindow *window = &sRxWindows[0];
+    otInstance    *instance;
+    uint32_t       now;
+    uint32_t       start;
+
+    otEXPECT(!getInternalFlag(FLAG_SCHEDULED_RX_PENDING) && !isRadioTransmittingOrScanning());
+
+    if (sRxWindowEnded && sRxWindowHeadArmed && (sRxWindowCount > 0))
+    {
+        sRxWindowStats.mCompleted++;
+        rxWindowRemoveHead();
+    }
+
+    now = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+
+    while ((sRxWindowCount > 0) && ((int32_t)(rxWindowEnd(window) - now) <= 0))
+    {
+        sRxWindowStats.mMissed++;
+        rxWindowRemoveHead();
+    }
+
+    otEXPECT(sRxWindowCount > 0);
+
+    // A window armed late, or again after an interruption, only covers its remaining time.
+    start = ((int32_t)(window->mStart - now) > 0) ? window->mStart : now;
+
+    instance = (sRxWindowInstance != NULL) ? sRxWindowInstance : sInstance;
+
+    if (efr32RadioLoadChannelConfig(window->mChannel, sl_get_tx_power_for_current_channel(instance)) != OT_ERROR_NONE)
+    {
+        sRxWindowStats.mMissed++;
+        rxWindowRemoveHead();
+        ExitNow();
+    }
+
+    // Set the flag first and then schedule the Rx as the rail scheduler can trigger the events even before
+    // sl_rail_start_scheduled_rx() API returns the status if start time is too close to the current time which could
+    // otherwise cause the race condition.
+    setInternalFlag(FLAG_SCHEDULED_RX_PENDING, true);
+
+    if (radioScheduleRx(window->mChannel, start, rxWindowEnd(window) - start) != OT_ERROR_NONE)
+    {
+        setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false);
+        sRxWindowStats.mMissed++;
+        rxWindowRemoveHead();
+        ExitNow();
+    }
+
+    sRxWindowStats.mArmed++;
+
+    if (sRxWindowHeadArmed)
+    {
+        sRxWindowStats.mResumed++;
+    }
+
+    sRxWindowHeadArmed = true;
+    sRxWindowEnded     = false;
+
+    sReceive.frame.mChannel    = window->mChannel;
+    sReceiveAck.frame.mChannel = window->mChannel;
+
+exit:
+    return;
+}
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 
 //------------------------------------------------------------------------------
@@ -1138,11 +1605,45 @@ static sl_rail_handle_t efr32RailInit(efr32CommonConfig *aCommonConfig)
     return handle;
 }
 
+static void efr32PhyTimingUpdate(void)
+{
+    uint32_t symbolRate = sl_rail_get_symbol_rate(gRailHandle);
+    uint32_t bitRate    = sl_rail_get_bit_rate(gRailHandle);
+
+    sPhyTiming.mSymbolTimeUsFp = (symbolRate > 0)
+                                     ? ((1000000UL << EFR32_PHY_TIMING_FRACTION_BITS) + symbolRate / 2) / symbolRate
+                                     : (RADIO_TIMING_DEFAULT_SYMBOLTIME_US << EFR32_PHY_TIMING_FRACTION_BITS);
+    sPhyTiming.mByteTimeUsFp   = (bitRate > 0)
+                                     ? ((8000000UL << EFR32_PHY_TIMING_FRACTION_BITS) + bitRate / 2) / bitRate
+                                     : (RADIO_TIMING_DEFAULT_BYTETIME_US << EFR32_PHY_TIMING_FRACTION_BITS);
+
+    sPhyTiming.mSymbolTimeUs =
+        (uint16_t)((sPhyTiming.mSymbolTimeUsFp + (1U << (EFR32_PHY_TIMING_FRACTION_BITS - 1)))
+                   >> EFR32_PHY_TIMING_FRACTION_BITS);
+    if (sPhyTiming.mSymbolTimeUs == 0)
+    {
+        sPhyTiming.mSymbolTimeUs = 1;
+    }
+
+    sPhyTiming.mShrDurationUs = (uint16_t)efr32PhyBytesToUs(SHR_SIZE);
+    sPhyTiming.mPhrDurationUs = (uint16_t)efr32PhyBytesToUs(PHY_HEADER_SIZE);
+    sPhyTiming.mAckWaitUs =
+        (uint16_t)((EFR32_PHY_TIMING_ACK_WAIT_SYMBOLS * sPhyTiming.mSymbolTimeUsFp) >> EFR32_PHY_TIMING_FRACTION_BITS);
+    sPhyTiming.mCsmaOverheadUs = RADIO_TIMING_CSMA_OVERHEAD_US;
+
+    // PHR of the received frame, rx to tx turnaround, then PHR and SHR of the ACK.
+    sPhyTiming.mEnhAckShrOffsetUs = (uint16_t)(sPhyTiming.mPhrDurationUs + sRailIeee802154Config.timings.rx_to_tx
+                                               + sPhyTiming.mPhrDurationUs + sPhyTiming.mShrDurationUs);
+}
+
 static void efr32RailConfigLoad(efr32BandConfig *aBandConfig, int8_t aTxPower)
 {
     sl_rail_status_t           status;
     sl_rail_tx_power_config_t *txPowerConfig = NULL;
 
+    gRadioReconfigCounters.mBandConfigLoads++;
+    sli_invalidate_tx_power_in_rail();
+
     if (aBandConfig->mChannelConfig != NULL)
     {
         status = sl_rail_ieee802154_set_phy_id(gRailHandle, RAIL_IEEE802154_PTI_RADIO_CONFIG_915MHZ_R23_NA_EXT);
@@ -1181,6 +1682,8 @@ static void efr32RailConfigLoad(efr32BandConfig *aBandConfig, int8_t aTxPower)
                                         (SL_RAIL_IEEE802154_E_OPTION_GB868 | SL_RAIL_IEEE802154_E_OPTION_ENH_ACK));
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 
+    efr32PhyTimingUpdate();
+
     if (aTxPower != SL_INVALID_TX_POWER)
     {
         sli_update_tx_power_after_config_update(txPowerConfig, aTxPower);
@@ -1254,6 +1757,10 @@ void efr32RadioInit(void)
     // check the limits of the RAIL_TX_FIFO_SIZE.
     OT_ASSERT((RAIL_TX_FIFO_SIZE >= SL_RAIL_MINIMUM_FIFO_BYTES) || (RAIL_TX_FIFO_SIZE <= SL_RAIL_MAXIMUM_FIFO_BYTES));
 
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    IgnoreError(efr32RadioResetBenchCounters());
+#endif
+
     efr32ConfigInit(RAILCb_Generic);
     setInternalFlag(FLAG_RADIO_INIT_DONE, true);
     status = sl_rail_config_sleep(gRailHandle, &timer_sync_config);
@@ -1266,13 +1773,8 @@ void efr32RadioInit(void)
     sReceiveAck.frame.mPsdu   = sReceiveAckPsdu;
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-    // Initialize the queue for received packets.
-    queueStatus = queueInit(&sPendingCommandQueue, RADIO_REQUEST_BUFFER_COUNT);
-    OT_ASSERT(queueStatus);
-
-    // Specify a callback to be called upon queue overflow.
-    queueStatus = queueOverflow(&sPendingCommandQueue, &pendingCommandQueueOverflowCallback);
-    OT_ASSERT(queueStatus);
+    sPendingCommandMask    = 0;
+    sPendingCommandLastIid = 0;
 #endif
 
     for (uint8_t i = 0; i < RADIO_REQUEST_BUFFER_COUNT; i++)
@@ -1334,6 +1836,10 @@ void efr32RadioDeinit(void)
 {
     sl_rail_status_t status;
 
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    noiseFloorStop();
+#endif
+
     sl_rail_idle(gRailHandle, SL_RAIL_IDLE_ABORT, true);
     status = sl_rail_config_events(gRailHandle, SL_RAIL_EVENTS_ALL, 0);
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
@@ -1351,114 +1857,1503 @@ static void energyScanComplete(int8_t scanResultDbm)
 {
     sEnergyScanResultDbm = scanResultDbm;
     sEnergyScanStatus    = ENERGY_SCAN_STATUS_COMPLETED;
+    residencyUpdate();
 }
 
-static uint16_t efr32GetSymbolDurationUs(void)
+static inline uint16_t efr32GetSymbolDurationUs(void)
 {
-    uint32_t symbolRate = sl_rail_get_symbol_rate(gRailHandle);
-    if (symbolRate)
-    {
-        symbolRate = (uint16_t)(1000000 / symbolRate);
-    }
-    return (symbolRate > 0) ? (uint16_t)symbolRate : 1;
+    return sPhyTiming.mSymbolTimeUs;
 }
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
-static void efr32ScanTimerHandler(struct sl_rail_multi_timer *tmr, sl_rail_time_t expectedTimeOfEvent, void *cbArg)
+static inline uint8_t rssiHistogramBin(int8_t aRssi)
 {
-    OT_UNUSED_VARIABLE(tmr);
-    OT_UNUSED_VARIABLE(expectedTimeOfEvent);
-    OT_UNUSED_VARIABLE(cbArg);
-    int16_t currentRSSIQuarterdBm =
-        sl_rail_get_rssi(gRailHandle,
-                         ((sScanFrameCounter == sScanFrameCounterMax) ? SL_RAIL_GET_RSSI_WAIT_WITHOUT_TIMEOUT
-                                                                      : SL_RAIL_GET_RSSI_NO_WAIT));
+    return (uint8_t)(aRssi - ENERGY_READS_MAX) / EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM;
+}
 
-    if (currentRSSIQuarterdBm != SL_RAIL_RSSI_INVALID)
+// Returns the upper edge of the histogram bin the given percentile of the samples falls into.
+static int8_t rssiHistogramPercentile(const uint32_t *aHistogram, uint32_t aSampleCount, uint8_t aPercentile)
+{
+    uint32_t target = (aSampleCount * aPercentile + 99U) / 100U;
+    uint32_t count  = 0;
+    uint8_t  bin    = 0;
+
+    for (; bin < EFR32_RSSI_HISTOGRAM_BIN_COUNT - 1; bin++)
     {
-        int8_t currentRSSI = (int8_t)(currentRSSIQuarterdBm / QUARTER_DBM_IN_DBM);
-        if (sEnergyReadsMax < currentRSSI)
+        count += aHistogram[bin];
+
+        if (count >= target)
         {
-            sEnergyReadsMax = currentRSSI;
+            break;
         }
     }
 
-    if (sScanFrameCounter != 0)
+    return (int8_t)(ENERGY_READS_MAX + (bin + 1) * EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM - 1);
+}
+
+static void energySweepStartChannel(uint8_t aChannel)
+{
+    sEnergySweepChannel     = aChannel;
+    sEnergySweepMax         = ENERGY_READS_MAX;
+    sEnergySweepSum         = 0;
+    sEnergySweepSampleCount = 0;
+    memset(sEnergySweepHistogram, 0, sizeof(sEnergySweepHistogram));
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void energySweepAddSample(int8_t aRssi)
+{
+    otEXPECT(sEnergySweepSampleCount < UINT32_MAX);
+
+    if (sEnergySweepMax < aRssi)
+    {
+        sEnergySweepMax = aRssi;
+    }
+
+    sEnergySweepSum += aRssi;
+    sEnergySweepSampleCount++;
+    sEnergySweepHistogram[rssiHistogramBin(aRssi)]++;
+
+exit:
+    return;
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void energySweepFinishChannel(void)
+{
+    efr32EnergySweepResult *result = &sEnergySweepResults[sEnergySweepResultCount++];
+
+    result->mChannel        = sEnergySweepChannel;
+    result->mSampleCount    = sEnergySweepSampleCount;
+    result->mMaxRssi        = OT_RADIO_RSSI_INVALID;
+    result->mMeanRssi       = OT_RADIO_RSSI_INVALID;
+    result->mPercentileRssi = OT_RADIO_RSSI_INVALID;
+
+    otEXPECT(sEnergySweepSampleCount != 0);
+
+    result->mMaxRssi  = sEnergySweepMax;
+    result->mMeanRssi = (int8_t)(sEnergySweepSum / (int64_t)sEnergySweepSampleCount);
+
+    result->mPercentileRssi =
+        rssiHistogramPercentile(sEnergySweepHistogram, sEnergySweepSampleCount, SL_OPENTHREAD_ENERGY_SWEEP_PERCENTILE);
+
+    if (result->mPercentileRssi > sEnergySweepMax)
+    {
+        result->mPercentileRssi = sEnergySweepMax;
+    }
+
+exit:
+    return;
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static bool energySweepNextChannel(void)
+{
+    bool    started = false;
+    uint8_t channel;
+
+    energySweepFinishChannel();
+
+    otEXPECT(sEnergySweepChannelMask != 0);
+
+    channel = (uint8_t)__builtin_ctz(sEnergySweepChannelMask);
+    sEnergySweepChannelMask &= ~BIT32(channel);
+
+    energySweepStartChannel(channel);
+    sScanFrameCounter = sScanFrameCounterMax;
+
+    // Channels of a sweep share the band configuration, only the receive channel changes.
+    otEXPECT(radioSetRx(channel) == OT_ERROR_NONE);
+    otEXPECT(efr32ScanDwell(SYMBOLS_PER_ENERGY_READING) == SL_RAIL_STATUS_NO_ERROR);
+
+    started = true;
+
+exit:
+    return started;
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void efr32ScanTimerHandler(struct sl_rail_multi_timer *tmr, sl_rail_time_t expectedTimeOfEvent, void *cbArg)
+{
+    OT_UNUSED_VARIABLE(tmr);
+    OT_UNUSED_VARIABLE(expectedTimeOfEvent);
+    OT_UNUSED_VARIABLE(cbArg);
+    int16_t currentRSSIQuarterdBm =
+        sl_rail_get_rssi(gRailHandle,
+                         ((sScanFrameCounter == sScanFrameCounterMax) ? SL_RAIL_GET_RSSI_WAIT_WITHOUT_TIMEOUT
+                                                                      : SL_RAIL_GET_RSSI_NO_WAIT));
+
+    if (currentRSSIQuarterdBm != SL_RAIL_RSSI_INVALID)
+    {
+        int8_t currentRSSI = (int8_t)(currentRSSIQuarterdBm / QUARTER_DBM_IN_DBM);
+        if (sEnergyReadsMax < currentRSSI)
+        {
+            sEnergyReadsMax = currentRSSI;
+        }
+
+        if (sEnergyScanMode == ENERGY_SCAN_MODE_SWEEP)
+        {
+            energySweepAddSample(currentRSSI);
+        }
+    }
+
+    if (sScanFrameCounter != 0)
     {
         efr32ScanDwell(SYMBOLS_PER_ENERGY_READING);
         sScanFrameCounter--;
     }
+    else if ((sEnergyScanMode == ENERGY_SCAN_MODE_SWEEP) && energySweepNextChannel())
+    {
+        // The sweep moved on to its next channel.
+    }
+    else
+    {
+        // done energy scan, reporting rssi value
+        energyScanComplete(sEnergyReadsMax);
+        OT_ASSERT(
+            sl_rail_config_rx_options(gRailHandle, SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION, SL_RAIL_RX_OPTIONS_NONE)
+            == SL_RAIL_STATUS_NO_ERROR);
+#if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
+        railDebugCounters.mRailPlatRadioEnergyScanDoneCbCount++;
+#endif
+    }
+}
+
+static sl_rail_status_t efr32ScanDwell(uint16_t symbols)
+{
+    sl_rail_cancel_multi_timer(gRailHandle, &rail_timer);
+    return sl_rail_set_multi_timer(gRailHandle,
+                                   &rail_timer,
+                                   symbols * efr32GetSymbolDurationUs(),
+                                   SL_RAIL_TIME_DELAY,
+                                   efr32ScanTimerHandler,
+                                   NULL);
+}
+
+static otError efr32StartEnergyScan(energyScanMode aMode, uint16_t aChannel, sl_rail_time_t aAveragingTimeUs)
+{
+    sl_rail_status_t status = SL_RAIL_STATUS_NO_ERROR;
+    otError          error  = OT_ERROR_NONE;
+    efr32BandConfig *config = NULL;
+
+    otEXPECT_ACTION(sEnergyScanStatus == ENERGY_SCAN_STATUS_IDLE, error = OT_ERROR_BUSY);
+
+    sEnergyScanStatus = ENERGY_SCAN_STATUS_IN_PROGRESS;
+    sEnergyScanMode   = aMode;
+    residencyUpdate();
+
+    config = efr32RadioGetBandConfig(aChannel);
+    otEXPECT_ACTION(config != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    // A radio which is idle or only listening is moved to the scanned channel by radioSetRx() below, anything
+    // else in progress, such as a frame being received or transmitted, is stopped first.
+    switch (sl_rail_get_radio_state(gRailHandle))
+    {
+    case SL_RAIL_RF_STATE_IDLE:
+    case SL_RAIL_RF_STATE_RX:
+        break;
+
+    default:
+        sl_rail_idle(gRailHandle, SL_RAIL_IDLE, true);
+        break;
+    }
+
+    if (sCurrentBandConfig != config)
+    {
+        sl_rail_idle(gRailHandle, SL_RAIL_IDLE, true);
+        efr32RailConfigLoad(config, SL_INVALID_TX_POWER);
+        sCurrentBandConfig = config;
+    }
+    else
+    {
+        gRadioReconfigCounters.mBandConfigLoadsAvoided++;
+    }
+    if (sScanFrameCounter != 0)
+    {
+        return OT_ERROR_FAILED;
+    }
+
+    sEnergyReadsMax      = ENERGY_READS_MAX;
+    sScanFrameCounterMax = aAveragingTimeUs / (efr32GetSymbolDurationUs() * SYMBOLS_PER_ENERGY_READING);
+    sScanFrameCounter    = sScanFrameCounterMax;
+
+    status = sl_rail_config_rx_options(gRailHandle,
+                                       SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION,
+                                       SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION);
+    otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
+
+    // set radio to Rx
+    otEXPECT_ACTION(radioSetRx(aChannel) == OT_ERROR_NONE, error = OT_ERROR_FAILED);
+
+    // start energy scan
+    status = efr32ScanDwell(SYMBOLS_PER_ENERGY_READING);
+    otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
+
+exit:
+    if (status != SL_RAIL_STATUS_NO_ERROR)
+    {
+        energyScanComplete(OT_RADIO_RSSI_INVALID);
+    }
+    return error;
+}
+
+otError efr32RadioStartEnergySweep(uint32_t aChannelMask, uint16_t aDwellTimeMs)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t channel;
+
+    otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
+    otEXPECT_ACTION((aChannelMask != 0) && (aDwellTimeMs != 0), error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(!isRadioTransmittingOrScanning(), error = OT_ERROR_BUSY);
+
+    for (uint32_t mask = aChannelMask; mask != 0; mask &= mask - 1)
+    {
+        channel = (uint8_t)__builtin_ctz(mask);
+        otEXPECT_ACTION(efr32RadioGetBandConfig(channel) == sCurrentBandConfig, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    channel = (uint8_t)__builtin_ctz(aChannelMask);
+
+    sEnergySweepChannelMask = aChannelMask & ~BIT32(channel);
+    sEnergySweepResultCount = 0;
+    sEnergySweepResumeRx    = (otPlatRadioGetState(NULL) == OT_RADIO_STATE_RECEIVE);
+    energySweepStartChannel(channel);
+
+    error = efr32StartEnergyScan(ENERGY_SCAN_MODE_SWEEP, channel, (sl_rail_time_t)aDwellTimeMs * US_IN_MS);
+
+exit:
+    return error;
+}
+
+otError efr32RadioGetEnergySweepResults(efr32EnergySweepResult *aResults, uint8_t *aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION((aResults != NULL) && (aNumEntries != NULL), error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(sEnergyScanMode != ENERGY_SCAN_MODE_SWEEP || sEnergyScanStatus == ENERGY_SCAN_STATUS_IDLE,
+                    error = OT_ERROR_BUSY);
+
+    if (*aNumEntries > sEnergySweepResultCount)
+    {
+        *aNumEntries = sEnergySweepResultCount;
+    }
+
+    memcpy(aResults, sEnergySweepResults, *aNumEntries * sizeof(efr32EnergySweepResult));
+
+exit:
+    return error;
+}
+
+OT_TOOL_WEAK void otPlatRadioExtensionEnergySweepDone(uint8_t aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aNumEntries);
+}
+
+//------------------------------------------------------------------------------
+// Background noise floor monitor
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+static void noiseFloorRestartWindow(uint8_t aChannel)
+{
+    sNoiseFloorStats.mChannel  = aChannel;
+    sNoiseFloorWindowCount     = 0;
+    sNoiseFloorWindowBusyCount = 0;
+    memset(sNoiseFloorStats.mHistogram, 0, sizeof(sNoiseFloorStats.mHistogram));
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void noiseFloorAddSample(uint8_t aChannel, int8_t aRssi)
+{
+    bool isBusy = (aRssi >= sCcaThresholdDbm);
+
+    if (aChannel != sNoiseFloorStats.mChannel)
+    {
+        noiseFloorRestartWindow(aChannel);
+    }
+
+    // Once the window is full, older samples are aged out by halving the whole histogram.
+    if (sNoiseFloorWindowCount >= SL_OPENTHREAD_NOISE_FLOOR_MONITOR_WINDOW)
+    {
+        sNoiseFloorWindowCount = 0;
+
+        for (uint8_t bin = 0; bin < EFR32_RSSI_HISTOGRAM_BIN_COUNT; bin++)
+        {
+            sNoiseFloorStats.mHistogram[bin] /= 2;
+            sNoiseFloorWindowCount += (uint16_t)sNoiseFloorStats.mHistogram[bin];
+        }
+
+        sNoiseFloorWindowBusyCount /= 2;
+    }
+
+    sNoiseFloorStats.mHistogram[rssiHistogramBin(aRssi)]++;
+    sNoiseFloorWindowCount++;
+    sNoiseFloorStats.mSampleCount++;
+
+    if (isBusy)
+    {
+        sNoiseFloorWindowBusyCount++;
+        sNoiseFloorStats.mBusySampleCount++;
+    }
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void noiseFloorTimerHandler(struct sl_rail_multi_timer *tmr, sl_rail_time_t expectedTimeOfEvent, void *cbArg)
+{
+    OT_UNUSED_VARIABLE(tmr);
+    OT_UNUSED_VARIABLE(expectedTimeOfEvent);
+    OT_UNUSED_VARIABLE(cbArg);
+
+    int16_t rssiQuarterDbm;
+
+    // Only sample an idle channel: no frame being received, no transmission and no scan on the radio.
+    otEXPECT(sl_rail_get_radio_state(gRailHandle) == SL_RAIL_RF_STATE_RX);
+    otEXPECT(sEnergyScanStatus == ENERGY_SCAN_STATUS_IDLE);
+    otEXPECT(!getInternalFlag(FLAG_ONGOING_TX_DATA) && !getInternalFlag(FLAG_ONGOING_TX_ACK));
+
+    rssiQuarterDbm = sl_rail_get_rssi(gRailHandle, SL_RAIL_GET_RSSI_NO_WAIT);
+    otEXPECT(rssiQuarterDbm != SL_RAIL_RSSI_INVALID);
+
+    noiseFloorAddSample(sReceive.frame.mChannel, (int8_t)(rssiQuarterDbm / QUARTER_DBM_IN_DBM));
+
+exit:
+    noiseFloorArmTimer();
+}
+
+static void noiseFloorArmTimer(void)
+{
+    otEXPECT(sNoiseFloorListening && (sNoiseFloorIntervalUs != 0));
+
+    (void)sl_rail_set_multi_timer(gRailHandle,
+                                  &sNoiseFloorTimer,
+                                  sNoiseFloorIntervalUs,
+                                  SL_RAIL_TIME_DELAY,
+                                  noiseFloorTimerHandler,
+                                  NULL);
+
+exit:
+    return;
+}
+
+// Sampling only runs while the radio listens in the background, it is armed once when entering receive
+// so that frequent returns to receive after transmissions do not keep pushing the next sample out.
+static void noiseFloorStart(void)
+{
+    otEXPECT(!sNoiseFloorListening);
+
+    sNoiseFloorListening = true;
+    noiseFloorArmTimer();
+
+exit:
+    return;
+}
+
+static void noiseFloorStop(void)
+{
+    sNoiseFloorListening = false;
+    sl_rail_cancel_multi_timer(gRailHandle, &sNoiseFloorTimer);
+}
+#endif // SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+
+otError efr32RadioSetNoiseFloorMonitorInterval(uint32_t aIntervalUs)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    sl_rail_cancel_multi_timer(gRailHandle, &sNoiseFloorTimer);
+    sNoiseFloorIntervalUs = aIntervalUs;
+    noiseFloorArmTimer();
+#else
+    OT_UNUSED_VARIABLE(aIntervalUs);
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+otError efr32RadioGetNoiseFloorStats(efr32NoiseFloorStats *aStats)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    uint16_t windowCount;
+    uint16_t windowBusyCount;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    otEXPECT_ACTION(aStats != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    CORE_ENTER_ATOMIC();
+    *aStats         = sNoiseFloorStats;
+    windowCount     = sNoiseFloorWindowCount;
+    windowBusyCount = sNoiseFloorWindowBusyCount;
+    CORE_EXIT_ATOMIC();
+
+    aStats->mNoiseFloor = OT_RADIO_RSSI_INVALID;
+    aStats->mBusyRatio  = 0;
+
+    if (windowCount != 0)
+    {
+        aStats->mNoiseFloor =
+            rssiHistogramPercentile(aStats->mHistogram, windowCount, SL_OPENTHREAD_NOISE_FLOOR_MONITOR_PERCENTILE);
+        aStats->mBusyRatio = (uint16_t)(((uint32_t)windowBusyCount * 10000U) / windowCount);
+    }
+#else
+    OT_UNUSED_VARIABLE(aStats);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearNoiseFloorStats(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    sNoiseFloorStats.mSampleCount     = 0;
+    sNoiseFloorStats.mBusySampleCount = 0;
+    noiseFloorRestartWindow(sNoiseFloorStats.mChannel);
+    CORE_EXIT_ATOMIC();
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Adaptive CCA threshold
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+static int8_t noiseFloorEstimate(void)
+{
+    int8_t noiseFloor = OT_RADIO_RSSI_INVALID;
+
+#if SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE
+    efr32NoiseFloorStats stats;
+
+    if ((efr32RadioGetNoiseFloorStats(&stats) == OT_ERROR_NONE) && (stats.mChannel == sReceive.frame.mChannel))
+    {
+        noiseFloor = stats.mNoiseFloor;
+    }
+#endif
+
+    return noiseFloor;
+}
+
+static void adaptiveCcaSetThreshold(int8_t aThresholdDbm)
+{
+    if (aThresholdDbm < SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM)
+    {
+        aThresholdDbm = SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM;
+        sAdaptiveCcaCounters.mClampedCount++;
+    }
+    else if (aThresholdDbm > SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM)
+    {
+        aThresholdDbm = SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM;
+        sAdaptiveCcaCounters.mClampedCount++;
+    }
+
+    otEXPECT(aThresholdDbm != sCcaThresholdDbm);
+
+    sCcaThresholdDbm = aThresholdDbm;
+    setCcaThreshold();
+
+exit:
+    return;
+}
+
+// Called from the main loop once per completed transmission.
+static void adaptiveCcaUpdate(otError aTxStatus)
+{
+    int8_t noiseFloor;
+    int8_t threshold = sCcaThresholdDbm;
+
+    otEXPECT(sAdaptiveCcaEnabled);
+
+    sAdaptiveCcaWindowTxCount++;
+    sAdaptiveCcaCounters.mTxCount++;
+
+    if (aTxStatus == OT_ERROR_CHANNEL_ACCESS_FAILURE)
+    {
+        sAdaptiveCcaWindowCcaFailCount++;
+        sAdaptiveCcaCounters.mCcaFailCount++;
+    }
+    else if (aTxStatus == OT_ERROR_NO_ACK)
+    {
+        sAdaptiveCcaWindowNoAckCount++;
+        sAdaptiveCcaCounters.mNoAckCount++;
+    }
+
+    otEXPECT(sAdaptiveCcaWindowTxCount >= SL_OPENTHREAD_ADAPTIVE_CCA_WINDOW);
+
+    sAdaptiveCcaCounters.mWindowCount++;
+    noiseFloor = noiseFloorEstimate();
+
+    if (sAdaptiveCcaWindowNoAckCount * 100U
+        > sAdaptiveCcaWindowTxCount * SL_OPENTHREAD_ADAPTIVE_CCA_NO_ACK_LIMIT_PERCENT)
+    {
+        // Frames are lost although the channel looked clear: be more conservative.
+        threshold -= SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB;
+        sAdaptiveCcaCounters.mLoweredCount++;
+    }
+    else if (sAdaptiveCcaWindowCcaFailCount * 100U
+             > sAdaptiveCcaWindowTxCount * SL_OPENTHREAD_ADAPTIVE_CCA_CCA_FAIL_LIMIT_PERCENT)
+    {
+        // Channel access keeps failing without losing frames: be more permissive.
+        threshold += SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB;
+        sAdaptiveCcaCounters.mRaisedCount++;
+    }
+    else if (noiseFloor != OT_RADIO_RSSI_INVALID)
+    {
+        // Otherwise converge towards the measured noise floor plus a margin.
+        int16_t target = noiseFloor + SL_OPENTHREAD_ADAPTIVE_CCA_NOISE_MARGIN_DB;
+
+        if (target > threshold)
+        {
+            threshold += SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB;
+            sAdaptiveCcaCounters.mRaisedCount++;
+        }
+        else if (target < threshold)
+        {
+            threshold -= SL_OPENTHREAD_ADAPTIVE_CCA_STEP_DB;
+            sAdaptiveCcaCounters.mLoweredCount++;
+        }
+    }
+
+    adaptiveCcaSetThreshold(threshold);
+
+    sAdaptiveCcaCounters.mNoiseFloorDbm = noiseFloor;
+    sAdaptiveCcaWindowTxCount           = 0;
+    sAdaptiveCcaWindowCcaFailCount      = 0;
+    sAdaptiveCcaWindowNoAckCount        = 0;
+
+exit:
+    return;
+}
+#endif // SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+
+otError efr32RadioSetAdaptiveCcaEnabled(bool aEnabled)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+    sAdaptiveCcaEnabled            = aEnabled;
+    sAdaptiveCcaWindowTxCount      = 0;
+    sAdaptiveCcaWindowCcaFailCount = 0;
+    sAdaptiveCcaWindowNoAckCount   = 0;
+#else
+    OT_UNUSED_VARIABLE(aEnabled);
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+otError efr32RadioGetAdaptiveCcaCounters(efr32AdaptiveCcaCounters *aCounters)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+    otEXPECT_ACTION(aCounters != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    *aCounters               = sAdaptiveCcaCounters;
+    aCounters->mThresholdDbm = sCcaThresholdDbm;
+#else
+    OT_UNUSED_VARIABLE(aCounters);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearAdaptiveCcaCounters(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+    memset(&sAdaptiveCcaCounters, 0, sizeof(sAdaptiveCcaCounters));
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Radio trace
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE
+#define RADIO_TRACE_NOW() sl_rail_get_time(SL_RAIL_EFR32_HANDLE)
+
+// Transmit events are tagged with the sequence number of the frame in flight, so they can be matched on the host.
+static inline uint8_t radioTraceTxIid(void)
+{
+    return (sCurrentTxPacket != NULL) ? sCurrentTxPacket->iid : 0;
+}
+
+static inline uint16_t radioTraceTxSequence(void)
+{
+    return (sCurrentTxPacket != NULL) ? sCurrentTxPacket->frame.mPsdu[IEEE802154_DSN_OFFSET] : 0;
+}
+
+#define RADIO_TRACE_TX(aEvent) EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), (aEvent), radioTraceTxIid(), radioTraceTxSequence())
+#define RADIO_TRACE_RX(aEvent) EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), (aEvent), 0, 0)
+#else
+#define RADIO_TRACE_TX(aEvent)
+#define RADIO_TRACE_RX(aEvent)
+#endif // SL_OPENTHREAD_RADIO_TRACE_ENABLE
+
+otError efr32RadioGetRadioTrace(efr32RadioTraceEntry *aEntries, uint16_t *aNumEntries, uint32_t *aTotalEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE
+    otEXPECT_ACTION((aEntries != NULL) && (aNumEntries != NULL), error = OT_ERROR_INVALID_ARGS);
+    efr32RadioTraceRead(aEntries, aNumEntries, aTotalEntries);
+#else
+    OT_UNUSED_VARIABLE(aEntries);
+    OT_UNUSED_VARIABLE(aNumEntries);
+    OT_UNUSED_VARIABLE(aTotalEntries);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearRadioTrace(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE
+    efr32RadioTraceClear();
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Radio benchmark
+
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+// The paths are accounted from both the RAIL callbacks and the main loop, hence the critical section in
+// radioBenchStop(). The drop counters are only updated from the RAIL callbacks.
+static efr32RadioBenchCounters sRadioBench;
+#endif
+
+// Returns the cycle counter value to hand to radioBenchStop() at the end of the path.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline uint32_t radioBenchStart(void)
+{
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void radioBenchStop(efr32RadioBenchPathId aPath, uint32_t aStart)
+{
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    uint32_t             cycles = DWT->CYCCNT - aStart;
+    efr32RadioBenchPath *path   = &sRadioBench.mPaths[aPath];
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    path->mCount++;
+    path->mCycles += cycles;
+
+    if (cycles > path->mMaxCycles)
+    {
+        path->mMaxCycles = cycles;
+    }
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aPath);
+    OT_UNUSED_VARIABLE(aStart);
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void radioBenchOnRxDropped(bool aOverflow)
+{
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    if (aOverflow)
+    {
+        sRadioBench.mRxOverflows++;
+    }
+    else
+    {
+        sRadioBench.mRxDropped++;
+    }
+#else
+    OT_UNUSED_VARIABLE(aOverflow);
+#endif
+}
+
+otError efr32RadioResetBenchCounters(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+
+    // The cycle counter of the DWT only runs once trace is enabled.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    CORE_ENTER_ATOMIC();
+    memset(&sRadioBench, 0, sizeof(sRadioBench));
+    CORE_EXIT_ATOMIC();
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+otError efr32RadioGetBenchCounters(efr32RadioBenchCounters *aCounters)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_BENCH_ENABLE
+    otEXPECT_ACTION(aCounters != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    *aCounters = sRadioBench;
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aCounters);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Sniffer capture
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+// State of the receiver of the stack, put back when the capture stops.
+static uint8_t sSnifferCaptureSavedChannel;
+static bool    sSnifferCaptureResumeRx;
+
+#if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+// Channels of the interfaces in the channel switching configuration, put back when the capture stops.
+static uint16_t sSnifferCaptureSavedChannels[SL_RAIL_IEEE802154_RX_CHANNEL_SWITCHING_NUM_CHANNELS];
+#endif
+
+// Called from the RAIL receive callback for every frame received while the capture is running.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void snifferCaptureRxPacket(const sl_rail_rx_packet_info_t    *aPacketInfo,
+                                   const sl_rail_rx_packet_details_t *aPacketDetails,
+                                   uint16_t                           aLength)
+{
+    // The ACK path converts the timestamp of the details again, work on a copy.
+    sl_rail_rx_packet_details_t details   = *aPacketDetails;
+    uint64_t                    timestamp = 0;
+    uint8_t                    *psdu;
+
+    // A frame whose SFD time is unknown is still captured, with a zero timestamp.
+    if (validatePacketTimestamp(&details, aLength))
+    {
+        timestamp = railTimeToPlatTime(details.time_received.packet_time);
+    }
+
+    // RAIL checks the FCS but does not keep it, the records only hold the frame up to the FCS.
+    psdu = efr32SnifferCaptureAlloc((uint8_t)(aLength - IEEE802154_FCS_LENGTH),
+                                    timestamp,
+                                    details.rssi_dbm,
+                                    details.lqi,
+                                    (uint8_t)details.channel);
+    otEXPECT(psdu != NULL);
+
+    sl_rail_copy_rx_packet(gRailHandle, psdu, aPacketInfo);
+    efr32SnifferCaptureCommit();
+
+exit:
+    return;
+}
+
+// Gives the receiver back to the stack, with the promiscuous mode and the channels it had set.
+static void snifferCaptureRestore(void)
+{
+    sl_rail_status_t status;
+
+    sSnifferCaptureActive = false;
+
+    status = sl_rail_ieee802154_set_promiscuous_mode(gRailHandle, sPromiscuous);
+    OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
+
+    sReceive.frame.mChannel    = sSnifferCaptureSavedChannel;
+    sReceiveAck.frame.mChannel = sSnifferCaptureSavedChannel;
+
+#if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+    for (uint8_t i = 0; i < SL_RAIL_IEEE802154_RX_CHANNEL_SWITCHING_NUM_CHANNELS; i++)
+    {
+        sChannelSwitchingCfg.channels[i] = sSnifferCaptureSavedChannels[i];
+    }
+#endif
+}
+#endif // SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+
+otError efr32RadioStartSnifferCapture(const uint8_t *aChannels, uint8_t aNumChannels)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+    efr32BandConfig *config;
+    sl_rail_status_t status;
+
+    otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
+    otEXPECT_ACTION((aChannels != NULL) && (aNumChannels > 0), error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(!isRadioTransmittingOrScanning(), error = OT_ERROR_BUSY);
+
+    config = efr32RadioGetBandConfig(aChannels[0]);
+    otEXPECT_ACTION(config != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint8_t i = 1; i < aNumChannels; i++)
+    {
+        otEXPECT_ACTION(efr32RadioGetBandConfig(aChannels[i]) != NULL, error = OT_ERROR_INVALID_ARGS);
+        // Fast channel switching listens on channels sharing a single band configuration.
+        otEXPECT_ACTION(efr32RadioGetBandConfig(aChannels[i]) == config, error = OT_ERROR_NOT_CAPABLE);
+    }
+
+    // A capture restarted on other channels keeps the state saved when the first one started.
+    if (!sSnifferCaptureActive)
+    {
+        sSnifferCaptureSavedChannel = sReceive.frame.mChannel;
+        sSnifferCaptureResumeRx     = (otPlatRadioGetState(NULL) == OT_RADIO_STATE_RECEIVE);
+    }
+
+#if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+    otEXPECT_ACTION(aNumChannels <= SL_RAIL_IEEE802154_RX_CHANNEL_SWITCHING_NUM_CHANNELS,
+                    error = OT_ERROR_NOT_CAPABLE);
+
+    // The capture channels take the place of the interface channels in the channel switching configuration, so
+    // radioSetRx() listens on all of them whenever the radio returns to receive.
+    for (uint8_t i = 0; i < SL_RAIL_IEEE802154_RX_CHANNEL_SWITCHING_NUM_CHANNELS; i++)
+    {
+        if (!sSnifferCaptureActive)
+        {
+            sSnifferCaptureSavedChannels[i] = sChannelSwitchingCfg.channels[i];
+        }
+        sChannelSwitchingCfg.channels[i] = (i < aNumChannels) ? aChannels[i] : UNINITIALIZED_CHANNEL;
+    }
+#else
+    otEXPECT_ACTION(aNumChannels == 1, error = OT_ERROR_NOT_CAPABLE);
+#endif
+
+    error = efr32RadioLoadChannelConfig(aChannels[0], sl_get_tx_power_for_current_channel(sInstance));
+    otEXPECT(error == OT_ERROR_NONE);
+
+    efr32SnifferCaptureReset();
+    sSnifferCaptureActive = true;
+
+    status = sl_rail_ieee802154_set_promiscuous_mode(gRailHandle, true);
+    OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
+
+    setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false);
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    rxWindowFlush();
+#endif
+
+    // The radio goes back to the capture channels after a transmission or an energy scan.
+    sReceive.frame.mChannel    = aChannels[0];
+    sReceiveAck.frame.mChannel = aChannels[0];
+
+    if (radioSetRx(aChannels[0]) != OT_ERROR_NONE)
+    {
+        snifferCaptureRestore();
+        error = OT_ERROR_FAILED;
+    }
+#else
+    OT_UNUSED_VARIABLE(aChannels);
+    OT_UNUSED_VARIABLE(aNumChannels);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioStopSnifferCapture(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+    otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
+    otEXPECT_ACTION(sSnifferCaptureActive, error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(!getInternalFlag(FLAG_ONGOING_TX_DATA), error = OT_ERROR_BUSY);
+
+    snifferCaptureRestore();
+
+    // Return to the state the radio was in before the capture.
+    if (sSnifferCaptureResumeRx)
+    {
+        error = efr32RadioLoadChannelConfig(sReceive.frame.mChannel, sl_get_tx_power_for_current_channel(sInstance));
+        otEXPECT(error == OT_ERROR_NONE);
+        error = radioSetRx(sReceive.frame.mChannel);
+    }
+    else
+    {
+        radioSetIdle();
+    }
+#else
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioReadSnifferCapture(uint8_t *aBuffer, uint16_t aBufferLength, uint16_t *aBatchLength)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+    otEXPECT_ACTION((aBuffer != NULL) && (aBatchLength != NULL)
+                        && (aBufferLength >= EFR32_SNIFFER_CAPTURE_BATCH_HEADER_SIZE),
+                    error = OT_ERROR_INVALID_ARGS);
+
+    *aBatchLength = efr32SnifferCaptureRead(aBuffer, aBufferLength);
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+    OT_UNUSED_VARIABLE(aBufferLength);
+    OT_UNUSED_VARIABLE(aBatchLength);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioGetSnifferCaptureCounters(efr32SnifferCaptureCounters *aCounters)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+    otEXPECT_ACTION(aCounters != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    efr32SnifferCaptureGetCounters(aCounters);
+#else
+    OT_UNUSED_VARIABLE(aCounters);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Transmit statistics
+
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+static efr32TxStats sTxStats[RADIO_INTERFACE_COUNT];
+static uint32_t     sTxStatsEnqueueTime[RADIO_REQUEST_BUFFER_COUNT];
+static bool         sTxStatsEnqueued[RADIO_REQUEST_BUFFER_COUNT];
+static uint32_t     sTxStatsStartTime;
+static uint32_t     sTxStatsSentTime;
+static uint32_t     sTxStatsAckTime;
+static uint8_t      sTxStatsCcaRetryCount;
+static bool         sTxStatsOnAir;
+static bool         sTxStatsAcked;
+static bool         sTxStatsScheduled;
+static bool         sTxStatsMissed;
+
+static void txStatsAddLatency(uint32_t *aHistogram, uint32_t *aMax, uint32_t aLatencyUs)
+{
+    aHistogram[efr32LatencyHistogramBin(aLatencyUs, EFR32_TX_LATENCY_HISTOGRAM_BIN_COUNT)]++;
+
+    if (aLatencyUs > *aMax)
+    {
+        *aMax = aLatencyUs;
+    }
+}
+#endif // SL_OPENTHREAD_TX_STATS_ENABLE
+
+// Called from otPlatRadioTransmit(), a request replayed from the pending command queue keeps its first timestamp.
+static inline void txStatsOnEnqueue(uint8_t aTxBufIndex)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    if (!sTxStatsEnqueued[aTxBufIndex])
+    {
+        sTxStatsEnqueueTime[aTxBufIndex] = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+        sTxStatsEnqueued[aTxBufIndex]    = true;
+    }
+#else
+    OT_UNUSED_VARIABLE(aTxBufIndex);
+#endif
+}
+
+static inline void txStatsOnEnqueueFailed(uint8_t aTxBufIndex)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsEnqueued[aTxBufIndex] = false;
+#else
+    OT_UNUSED_VARIABLE(aTxBufIndex);
+#endif
+}
+
+static inline void txStatsOnTxIssued(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsStartTime     = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+    sTxStatsCcaRetryCount = 0;
+    sTxStatsOnAir         = false;
+    sTxStatsAcked         = false;
+    sTxStatsScheduled     = (sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay != 0);
+    sTxStatsMissed        = false;
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void txStatsOnCcaRetry(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsCcaRetryCount++;
+#endif
+}
+
+// The frame goes on air once the channel is clear, or when a scheduled transmission starts.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void txStatsOnTxStarted(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsStartTime = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+    sTxStatsOnAir     = true;
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void txStatsOnScheduledTxMissed(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsMissed = true;
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void txStatsOnPacketSent(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    // Frames sent without CCA have no channel clear event, they went on air when handed to RAIL.
+    sTxStatsSentTime = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+    sTxStatsOnAir    = true;
+#endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void txStatsOnAckReceived(void)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    sTxStatsAckTime = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+    sTxStatsAcked   = true;
+#endif
+}
+
+// Called from the main loop, right before reporting the transmission to the stack.
+static inline void txStatsOnTxDone(otError aTxStatus)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    uint32_t      now = sl_rail_get_time(SL_RAIL_EFR32_HANDLE);
+    uint8_t       txBufIndex;
+    bool          enqueued;
+    efr32TxStats *stats;
+
+    // Only the frames of the request buffers are accounted for, Green Power responses are accounted for by the GP
+    // interface and the diag frames by the PER test.
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+    otEXPECT(sCurrentTxPacket != &sGpTransmitBuffer);
+#endif
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+    otEXPECT(sCurrentTxPacket != &sDiagTransmitBuffer);
+#endif
+    txBufIndex                   = (uint8_t)(sCurrentTxPacket - sTransmitBuffer);
+    enqueued                     = sTxStatsEnqueued[txBufIndex];
+    sTxStatsEnqueued[txBufIndex] = false;
+
+    otEXPECT(sCurrentTxPacket->iid < RADIO_INTERFACE_COUNT);
+    stats = &sTxStats[sCurrentTxPacket->iid];
+
+    stats->mTxCount++;
+    stats->mScheduledTxCount       += sTxStatsScheduled ? 1 : 0;
+    stats->mScheduledTxMissedCount += sTxStatsMissed ? 1 : 0;
+    stats->mCsmaBackoffs[(sTxStatsCcaRetryCount < EFR32_TX_CSMA_HISTOGRAM_BIN_COUNT)
+                             ? sTxStatsCcaRetryCount
+                             : (EFR32_TX_CSMA_HISTOGRAM_BIN_COUNT - 1)]++;
+
+    if (aTxStatus == OT_ERROR_CHANNEL_ACCESS_FAILURE)
+    {
+        stats->mCcaFailCount++;
+    }
+    else if (aTxStatus == OT_ERROR_NO_ACK)
+    {
+        stats->mNoAckCount++;
+    }
+
+    if (sTxStatsOnAir)
+    {
+        if (enqueued)
+        {
+            txStatsAddLatency(stats->mEnqueueToStart,
+                              &stats->mMaxEnqueueToStartUs,
+                              sTxStatsStartTime - sTxStatsEnqueueTime[txBufIndex]);
+        }
+
+        txStatsAddLatency(stats->mStartToDone, &stats->mMaxStartToDoneUs, now - sTxStatsStartTime);
+    }
+
+    if (sTxStatsAcked)
+    {
+        txStatsAddLatency(stats->mAckWait, &stats->mMaxAckWaitUs, sTxStatsAckTime - sTxStatsSentTime);
+    }
+
+exit:
+    return;
+#else
+    OT_UNUSED_VARIABLE(aTxStatus);
+#endif
+}
+
+// Called when a deferred transmission is reported to the stack without being started, its target time passed.
+static inline void txStatsOnDeadlineMissed(uint8_t aIid, uint8_t aTxBufIndex)
+{
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    efr32TxStats *stats;
+
+    otEXPECT(aIid < RADIO_INTERFACE_COUNT);
+    stats = &sTxStats[aIid];
+
+    stats->mTxCount++;
+    stats->mScheduledTxCount++;
+    stats->mScheduledTxMissedCount++;
+
+exit:
+    sTxStatsEnqueued[aTxBufIndex] = false;
+#else
+    OT_UNUSED_VARIABLE(aIid);
+    OT_UNUSED_VARIABLE(aTxBufIndex);
+#endif
+}
+
+otError efr32RadioGetTxStats(uint8_t aIid, efr32TxStats *aStats)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    otEXPECT_ACTION((aStats != NULL) && (aIid < RADIO_INTERFACE_COUNT), error = OT_ERROR_INVALID_ARGS);
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    *aStats = sTxStats[aIid];
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aIid);
+    OT_UNUSED_VARIABLE(aStats);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearTxStats(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_TX_STATS_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    memset(sTxStats, 0, sizeof(sTxStats));
+    CORE_EXIT_ATOMIC();
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Radio counters
+
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+#if RADIO_INTERFACE_COUNT > EFR32_RADIO_COUNTERS_INTERFACE_COUNT
+#error "EFR32_RADIO_COUNTERS_INTERFACE_COUNT is lower than the number of radio interfaces"
+#endif
+
+#define RADIO_COUNTERS_WORD_COUNT (sizeof(efr32RadioFrameCounters) / sizeof(uint32_t))
+
+// The receive counters are only updated from the RAIL callbacks and the transmit counters from the main loop,
+// so no counter is ever incremented from two contexts and updating them does not need a critical section.
+static efr32RadioFrameCounters sRadioChannelCounters[EFR32_RADIO_COUNTERS_CHANNEL_COUNT];
+static efr32RadioFrameCounters sRadioInterfaceCounters[RADIO_INTERFACE_COUNT];
+
+static void radioCountersIncrement(uint8_t aChannel, uint8_t aIid, size_t aOffset)
+{
+    if (aChannel < EFR32_RADIO_COUNTERS_CHANNEL_COUNT)
+    {
+        (*(uint32_t *)((uint8_t *)&sRadioChannelCounters[aChannel] + aOffset))++;
+    }
+
+    if (aIid < RADIO_INTERFACE_COUNT)
+    {
+        (*(uint32_t *)((uint8_t *)&sRadioInterfaceCounters[aIid] + aOffset))++;
+    }
+}
+
+#define RADIO_COUNTERS_INCREMENT(aChannel, aIid, aCounter) \
+    radioCountersIncrement((aChannel), (aIid), offsetof(efr32RadioFrameCounters, aCounter))
+#endif // SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void radioCountersOnRx(uint8_t aChannel, uint8_t aIid, bool aAccepted)
+{
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+    if (aAccepted)
+    {
+        RADIO_COUNTERS_INCREMENT(aChannel, aIid, mRxAccepted);
+    }
     else
     {
-        // done energy scan, reporting rssi value
-        energyScanComplete(sEnergyReadsMax);
-        OT_ASSERT(
-            sl_rail_config_rx_options(gRailHandle, SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION, SL_RAIL_RX_OPTIONS_NONE)
-            == SL_RAIL_STATUS_NO_ERROR);
-#if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
-        railDebugCounters.mRailPlatRadioEnergyScanDoneCbCount++;
+        RADIO_COUNTERS_INCREMENT(aChannel, aIid, mRxDropped);
+    }
+#else
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aIid);
+    OT_UNUSED_VARIABLE(aAccepted);
 #endif
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static inline void radioCountersOnEnhAckFailed(uint8_t aIid)
+{
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+    RADIO_COUNTERS_INCREMENT(sReceive.frame.mChannel, aIid, mEnhAckFail);
+#else
+    OT_UNUSED_VARIABLE(aIid);
+#endif
+}
+
+static inline void radioCountersOnTxDone(otError aTxStatus)
+{
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+    uint8_t channel = sCurrentTxPacket->frame.mChannel;
+    uint8_t iid     = sCurrentTxPacket->iid;
+
+    switch (aTxStatus)
+    {
+    case OT_ERROR_NONE:
+        RADIO_COUNTERS_INCREMENT(channel, iid, mTxSuccess);
+        break;
+    case OT_ERROR_CHANNEL_ACCESS_FAILURE:
+        RADIO_COUNTERS_INCREMENT(channel, iid, mTxCcaFail);
+        break;
+    case OT_ERROR_NO_ACK:
+        RADIO_COUNTERS_INCREMENT(channel, iid, mTxNoAck);
+        break;
+    default:
+        break;
     }
+#else
+    OT_UNUSED_VARIABLE(aTxStatus);
+#endif
 }
 
-static sl_rail_status_t efr32ScanDwell(uint16_t symbols)
+otError efr32RadioGetRadioCountersSnapshot(efr32RadioCountersSnapshot *aSnapshot)
 {
-    sl_rail_cancel_multi_timer(gRailHandle, &rail_timer);
-    return sl_rail_set_multi_timer(gRailHandle,
-                                   &rail_timer,
-                                   symbols * efr32GetSymbolDurationUs(),
-                                   SL_RAIL_TIME_DELAY,
-                                   efr32ScanTimerHandler,
-                                   NULL);
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+    otEXPECT_ACTION(aSnapshot != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    memset(aSnapshot->mInterface, 0, sizeof(aSnapshot->mInterface));
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    aSnapshot->mTimestamp = otPlatAlarmMilliGetNow();
+    memcpy(aSnapshot->mChannel, sRadioChannelCounters, sizeof(sRadioChannelCounters));
+    memcpy(aSnapshot->mInterface, sRadioInterfaceCounters, sizeof(sRadioInterfaceCounters));
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aSnapshot);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
 }
 
-static otError efr32StartEnergyScan(energyScanMode aMode, uint16_t aChannel, sl_rail_time_t aAveragingTimeUs)
+otError efr32RadioGetRadioCountersDelta(efr32RadioCountersSnapshot *aPrevious, efr32RadioCountersSnapshot *aDelta)
 {
-    sl_rail_status_t status = SL_RAIL_STATUS_NO_ERROR;
-    otError          error  = OT_ERROR_NONE;
-    efr32BandConfig *config = NULL;
+    otError error = OT_ERROR_NONE;
 
-    otEXPECT_ACTION(sEnergyScanStatus == ENERGY_SCAN_STATUS_IDLE, error = OT_ERROR_BUSY);
+#if SL_OPENTHREAD_RADIO_COUNTERS_ENABLE
+    uint32_t *previous;
+    uint32_t *delta;
+    uint32_t *current;
+    uint32_t  now;
 
-    sEnergyScanStatus = ENERGY_SCAN_STATUS_IN_PROGRESS;
-    sEnergyScanMode   = aMode;
+    otEXPECT_ACTION((aPrevious != NULL) && (aDelta != NULL), error = OT_ERROR_INVALID_ARGS);
 
-    sl_rail_idle(gRailHandle, SL_RAIL_IDLE, true);
+    memset(aDelta->mInterface, 0, sizeof(aDelta->mInterface));
 
-    config = efr32RadioGetBandConfig(aChannel);
-    otEXPECT_ACTION(config != NULL, error = OT_ERROR_INVALID_ARGS);
+    // The differences are computed in place rather than through a temporary snapshot, to keep it off the stack.
+    // Counters wrap around, so the unsigned differences stay correct across a wrap.
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    now                   = otPlatAlarmMilliGetNow();
+    aDelta->mTimestamp    = now - aPrevious->mTimestamp;
+    aPrevious->mTimestamp = now;
 
-    if (sCurrentBandConfig != config)
+    previous = (uint32_t *)aPrevious->mChannel;
+    delta    = (uint32_t *)aDelta->mChannel;
+    current  = (uint32_t *)sRadioChannelCounters;
+
+    for (size_t i = 0; i < EFR32_RADIO_COUNTERS_CHANNEL_COUNT * RADIO_COUNTERS_WORD_COUNT; i++)
     {
-        efr32RailConfigLoad(config, SL_INVALID_TX_POWER);
-        sCurrentBandConfig = config;
+        delta[i]    = current[i] - previous[i];
+        previous[i] = current[i];
     }
-    if (sScanFrameCounter != 0)
+
+    previous = (uint32_t *)aPrevious->mInterface;
+    delta    = (uint32_t *)aDelta->mInterface;
+    current  = (uint32_t *)sRadioInterfaceCounters;
+
+    for (size_t i = 0; i < RADIO_INTERFACE_COUNT * RADIO_COUNTERS_WORD_COUNT; i++)
     {
-        return OT_ERROR_FAILED;
+        delta[i]    = current[i] - previous[i];
+        previous[i] = current[i];
     }
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aPrevious);
+    OT_UNUSED_VARIABLE(aDelta);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
 
-    sEnergyReadsMax      = ENERGY_READS_MAX;
-    sScanFrameCounterMax = aAveragingTimeUs / (efr32GetSymbolDurationUs() * SYMBOLS_PER_ENERGY_READING);
-    sScanFrameCounter    = sScanFrameCounterMax;
+exit:
+    return error;
+}
 
-    status = sl_rail_config_rx_options(gRailHandle,
-                                       SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION,
-                                       SL_RAIL_RX_OPTION_DISABLE_FRAME_DETECTION);
-    otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
+//------------------------------------------------------------------------------
+// Radio state residency
 
-    // set radio to Rx
-    otEXPECT_ACTION(radioSetRx(aChannel) == OT_ERROR_NONE, error = OT_ERROR_FAILED);
+otError efr32RadioGetRadioResidency(efr32RadioResidency *aResidency)
+{
+    otError error = OT_ERROR_NONE;
 
-    // start energy scan
-    status = efr32ScanDwell(SYMBOLS_PER_ENERGY_READING);
-    otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+    otEXPECT_ACTION(aResidency != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    residencyAccount(otPlatTimeGet());
+    memcpy(aResidency->mTimeUs, sResidencyTimeUs, sizeof(sResidencyTimeUs));
+    aResidency->mTransitionCount = sResidencyTransitionCount;
+    aResidency->mState           = sResidencyState;
+    CORE_EXIT_ATOMIC();
+#else
+    OT_UNUSED_VARIABLE(aResidency);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioGetRadioTimeStats(otRadioTimeStats *aStats)
+{
+    otError             error = OT_ERROR_NONE;
+    efr32RadioResidency residency;
+    const uint64_t     *timeUs = residency.mTimeUs;
+
+    otEXPECT_ACTION(aStats != NULL, error = OT_ERROR_INVALID_ARGS);
+    error = efr32RadioGetRadioResidency(&residency);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    aStats->mDisabledTime = 0;
+    aStats->mSleepTime    = timeUs[EFR32_RADIO_RESIDENCY_SLEEP];
+    aStats->mTxTime       = timeUs[EFR32_RADIO_RESIDENCY_TX] + timeUs[EFR32_RADIO_RESIDENCY_ACK_TX];
+    aStats->mRxTime       = timeUs[EFR32_RADIO_RESIDENCY_RX] + timeUs[EFR32_RADIO_RESIDENCY_SCHEDULED_RX]
+                      + timeUs[EFR32_RADIO_RESIDENCY_ENERGY_SCAN];
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearRadioResidency(void)
+{
+    otError error = OT_ERROR_NONE;
+
+#if SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    residencyAccount(otPlatTimeGet());
+    memset(sResidencyTimeUs, 0, sizeof(sResidencyTimeUs));
+    sResidencyTransitionCount = 0;
+    CORE_EXIT_ATOMIC();
+#else
+    error = OT_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+// Radio reconfiguration counters
+
+otError efr32RadioGetRadioReconfigCounters(efr32RadioReconfigCounters *aCounters)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aCounters != NULL, error = OT_ERROR_INVALID_ARGS);
+    *aCounters = gRadioReconfigCounters;
+
+exit:
+    return error;
+}
+
+otError efr32RadioClearRadioReconfigCounters(void)
+{
+    memset(&gRadioReconfigCounters, 0, sizeof(gRadioReconfigCounters));
+
+    return OT_ERROR_NONE;
+}
+
+//------------------------------------------------------------------------------
+// CSL clock drift
+
+otError efr32RadioGetCslDriftEstimate(efr32CslDriftEstimate *aEstimate)
+{
+    otError error = OT_ERROR_NONE;
+
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE && SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+    uint32_t driftPpm;
+
+    otEXPECT_ACTION(aEstimate != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    driftPpm = (sCslDriftPpmFp + (1U << CSL_DRIFT_FRACTION_BITS) - 1) >> CSL_DRIFT_FRACTION_BITS;
+
+    aEstimate->mSampleCount = sCslDriftSampleCount;
+    aEstimate->mDriftPpm    = (driftPpm < UINT16_MAX) ? (uint16_t)driftPpm : UINT16_MAX;
+    aEstimate->mAccuracy    = cslDriftGetAccuracy(otPlatTimeGetXtalAccuracy());
+#else
+    OT_UNUSED_VARIABLE(aEstimate);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
 
 exit:
-    if (status != SL_RAIL_STATUS_NO_ERROR)
-    {
-        energyScanComplete(OT_RADIO_RSSI_INVALID);
-    }
     return error;
 }
 
@@ -1647,9 +3542,14 @@ otError otPlatRadioSleep(otInstance *aInstance)
     otError error = OT_ERROR_NONE;
 
     otEXPECT_ACTION(!getInternalFlag(FLAG_ONGOING_TX_DATA), error = OT_ERROR_BUSY);
+    otEXPECT_ACTION(!sSnifferCaptureActive, error = OT_ERROR_INVALID_STATE);
 
     otLogInfoPlat("State=OT_RADIO_STATE_SLEEP");
     setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false);
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    // The host puts the radio to sleep when it no longer expects the windows it scheduled.
+    rxWindowFlush();
+#endif
     radioSetIdle();
 
 exit:
@@ -1672,6 +3572,9 @@ otError efr32RadioLoadChannelConfig(uint8_t aChannel, int8_t aTxPower)
     }
     else
     {
+        // Same band, the channel is given to RAIL when starting the operation and the power write is
+        // skipped by the power manager when it did not change.
+        gRadioReconfigCounters.mBandConfigLoadsAvoided++;
         sli_set_tx_power_in_rail(aTxPower);
     }
 
@@ -1689,6 +3592,7 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
     otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
     otEXPECT_ACTION(!getInternalFlag(FLAG_ONGOING_TX_DATA) && sEnergyScanStatus != ENERGY_SCAN_STATUS_IN_PROGRESS,
                     error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(!sSnifferCaptureActive, error = OT_ERROR_INVALID_STATE);
 
     OT_UNUSED_VARIABLE(iid);
 #if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
@@ -1704,6 +3608,10 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
     status = radioSetRx(aChannel);
     otEXPECT_ACTION(status == SL_RAIL_STATUS_NO_ERROR, error = OT_ERROR_FAILED);
     setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false);
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    // Ending a window idles the radio, the pending windows would cut the continuous receive short.
+    rxWindowFlush();
+#endif
 
     sReceive.frame.mChannel    = aChannel;
     sReceiveAck.frame.mChannel = aChannel;
@@ -1715,42 +3623,81 @@ exit:
 #if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 otError otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel, uint32_t aStart, uint32_t aDuration)
 {
-    otError error   = OT_ERROR_NONE;
-    int8_t  txPower = sl_get_tx_power_for_current_channel(aInstance);
-
-    // We can only have one schedule request i.e. either Rx or Tx as they use the
-    // same RAIL resources.
-    otEXPECT_ACTION(!getInternalFlag(FLAG_SCHEDULED_TX_PENDING | EVENT_SCHEDULED_TX_STARTED), error = OT_ERROR_FAILED);
+    otError       error  = OT_ERROR_NONE;
+    efr32RxWindow window = {.mStart = aStart, .mDuration = aDuration, .mChannel = aChannel};
 
     otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
-    OT_UNUSED_VARIABLE(aInstance);
+    otEXPECT_ACTION(!sSnifferCaptureActive, error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(efr32RadioGetBandConfig(aChannel) != NULL, error = OT_ERROR_INVALID_ARGS);
 
-    error = efr32RadioLoadChannelConfig(aChannel, txPower);
+    // A scheduled transmission no longer rejects the window, the window is armed once the radio is free.
+    sRxWindowInstance = aInstance;
+    error             = rxWindowInsert(&window);
     otEXPECT(error == OT_ERROR_NONE);
 
-    // Set the flag first and then schedule the Rx as the rail scheduler can trigger the events even before
-    // sl_rail_start_scheduled_rx() API returns the status if start time is too close to the current time which could
-    // otherwise cause the race condition.
-    setInternalFlag(FLAG_SCHEDULED_RX_PENDING, true);
-    error = radioScheduleRx(aChannel, aStart, aDuration);
-    otEXPECT_ACTION(error == OT_ERROR_NONE, setInternalFlag(FLAG_SCHEDULED_RX_PENDING, false));
-
-    sReceive.frame.mChannel    = aChannel;
-    sReceiveAck.frame.mChannel = aChannel;
+    rxWindowProcess();
 
 exit:
     return error;
 }
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 
+otError efr32RadioScheduleRxWindows(const efr32RxWindow *aWindows, uint8_t aCount)
+{
+    otError error = OT_ERROR_NONE;
+
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
+    otEXPECT_ACTION(aWindows != NULL, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(aCount <= SL_OPENTHREAD_SCHEDULED_RX_QUEUE_SIZE - sRxWindowCount, error = OT_ERROR_NO_BUFS);
+
+    for (uint8_t i = 0; i < aCount; i++)
+    {
+        otEXPECT_ACTION(efr32RadioGetBandConfig(aWindows[i].mChannel) != NULL, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    for (uint8_t i = 0; i < aCount; i++)
+    {
+        IgnoreError(rxWindowInsert(&aWindows[i]));
+    }
+
+    rxWindowProcess();
+#else
+    OT_UNUSED_VARIABLE(aWindows);
+    OT_UNUSED_VARIABLE(aCount);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
+otError efr32RadioGetScheduledRxStats(efr32ScheduledRxStats *aStats)
+{
+    otError error = OT_ERROR_NONE;
+
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    otEXPECT_ACTION(aStats != NULL, error = OT_ERROR_INVALID_ARGS);
+    *aStats = sRxWindowStats;
+#else
+    OT_UNUSED_VARIABLE(aStats);
+    otEXPECT_ACTION(false, error = OT_ERROR_NOT_IMPLEMENTED);
+#endif
+
+exit:
+    return error;
+}
+
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
 inline static void pushPendingCommand(pendingCommandType aCmdType, uint8_t aIid, void *aCmdParams)
 {
-    pendingCommandEntry *pendingCommand = (pendingCommandEntry *)sl_malloc(sizeof(pendingCommandEntry));
-    OT_ASSERT(pendingCommand != NULL);
+    pendingCommandEntry *pendingCommand = &sPendingCommands[aIid];
+
+    // We should never have two pending commands for an interface because a host
+    // can only request one command at a time.
+    OT_ASSERT((sPendingCommandMask & (1U << aIid)) == 0);
 
     pendingCommand->cmdType = aCmdType;
-    pendingCommand->iid     = aIid;
 
     if (aCmdType == kPendingCommandTypeTransmit)
     {
@@ -1764,9 +3711,119 @@ inline static void pushPendingCommand(pendingCommandType aCmdType, uint8_t aIid,
         pendingCommand->request.energyScan.scanDuration = energyScanReq->scanDuration;
     }
 
-    if (!queueAdd(&sPendingCommandQueue, (void *)pendingCommand))
+    sPendingCommandMask |= (1U << aIid);
+}
+
+// Picks the next pending command to serve. Transmissions with a deadline, such as CSL frames, go first,
+// earliest deadline first. The other commands are served round robin across the interfaces, so a busy
+// host cannot starve the others.
+static uint8_t selectPendingCommand(void)
+{
+    uint8_t  selectedIid      = INVALID_INTERFACE_INDEX;
+    uint32_t earliestDeadline = 0;
+
+    for (uint8_t iid = 0; iid < RADIO_INTERFACE_COUNT; iid++)
+    {
+        otRadioFrame *txFrame = sPendingCommands[iid].request.txFrame;
+        uint32_t      deadline;
+
+        if (((sPendingCommandMask & (1U << iid)) == 0) || (sPendingCommands[iid].cmdType != kPendingCommandTypeTransmit)
+            || (txFrame->mInfo.mTxInfo.mTxDelay == 0))
+        {
+            continue;
+        }
+
+        deadline = txFrame->mInfo.mTxInfo.mTxDelayBaseTime + txFrame->mInfo.mTxInfo.mTxDelay;
+
+        if ((selectedIid == INVALID_INTERFACE_INDEX) || ((int32_t)(deadline - earliestDeadline) < 0))
+        {
+            selectedIid      = iid;
+            earliestDeadline = deadline;
+        }
+    }
+
+    for (uint8_t i = 1; (selectedIid == INVALID_INTERFACE_INDEX) && (i <= RADIO_INTERFACE_COUNT); i++)
+    {
+        uint8_t iid = (sPendingCommandLastIid + i) % RADIO_INTERFACE_COUNT;
+
+        if (sPendingCommandMask & (1U << iid))
+        {
+            selectedIid = iid;
+        }
+    }
+
+    return selectedIid;
+}
+
+// Returns whether a deferred transmission can no longer start at its target time. Such a frame is reported to
+// the stack right away instead of occupying the radio, so that the next deadline is not missed as well.
+static bool isPendingTransmitLate(const otRadioFrame *aFrame)
+{
+    uint32_t startTime =
+        aFrame->mInfo.mTxInfo.mTxDelayBaseTime + aFrame->mInfo.mTxInfo.mTxDelay - sPhyTiming.mShrDurationUs;
+
+    return (aFrame->mInfo.mTxInfo.mTxDelay != 0)
+           && ((int32_t)(startTime - sl_rail_get_time(SL_RAIL_EFR32_HANDLE)) <= 0);
+}
+
+static void reportPendingTransmitMissed(uint8_t aIid, otRadioFrame *aFrame)
+{
+    uint8_t txBufIndex = aIid - 1;
+
+    EFR32_RADIO_TRACE(RADIO_TRACE_NOW(),
+                      EFR32_RADIO_TRACE_SCHEDULED_TX_MISSED,
+                      aIid,
+                      aFrame->mPsdu[IEEE802154_DSN_OFFSET]);
+    EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), EFR32_RADIO_TRACE_TX_DONE, aIid, OT_ERROR_ABORT);
+    txStatsOnDeadlineMissed(aIid, txBufIndex);
+
+    aFrame->mInfo.mTxInfo.mTxDelayBaseTime = 0;
+    aFrame->mInfo.mTxInfo.mTxDelay         = 0;
+
+    otPlatRadioTxDone(otPlatMultipanIidToInstance(aIid), aFrame, NULL, OT_ERROR_ABORT);
+}
+
+// Dispatches pending commands until the radio is busy again. A command which fails to start does not
+// hold back the following ones until the next call.
+static void processPendingCommands(void)
+{
+    // A Green Power response due in its window goes before the commands of the hosts.
+    gpTransmitProcess();
+
+    while ((sPendingCommandMask != 0) && !isRadioTransmittingOrScanning())
     {
-        sl_free(pendingCommand);
+        uint8_t              iid            = selectPendingCommand();
+        pendingCommandEntry *pendingCommand = &sPendingCommands[iid];
+
+        OT_ASSERT(iid < RADIO_INTERFACE_COUNT);
+
+        // Release the slot first, the command may be pushed back if the radio turns out to be busy.
+        sPendingCommandMask &= ~(1U << iid);
+        sPendingCommandLastIid = iid;
+
+        switch (pendingCommand->cmdType)
+        {
+        case kPendingCommandTypeTransmit:
+            if (isPendingTransmitLate(pendingCommand->request.txFrame))
+            {
+                reportPendingTransmitMissed(iid, pendingCommand->request.txFrame);
+            }
+            else
+            {
+                otPlatRadioTransmit(otPlatMultipanIidToInstance(iid), pendingCommand->request.txFrame);
+            }
+            break;
+
+        case kPendingCommandTypeEnergyScan:
+            otPlatRadioEnergyScan(otPlatMultipanIidToInstance(iid),
+                                  pendingCommand->request.energyScan.scanChannel,
+                                  pendingCommand->request.energyScan.scanDuration);
+            break;
+
+        default:
+            OT_ASSERT(false);
+            break;
+        }
     }
 }
 #endif
@@ -1785,9 +3842,9 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     // Accept GP packets even if radio is not in required state.
-    if ((sl_gp_intf_get_state() != SL_GP_STATE_SEND_RESPONSE) && sl_gp_intf_should_buffer_pkt(aInstance, aFrame, false))
+    if (sl_gp_intf_should_buffer_pkt(aInstance, aFrame, false))
     {
-        sl_gp_intf_buffer_pkt(aInstance);
+        error = sl_gp_intf_buffer_pkt(aInstance, aFrame);
     }
     else
 #endif
@@ -1796,6 +3853,9 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
         OT_ASSERT(aFrame == &sTransmitBuffer[txBufIndex].frame);
         OT_ASSERT(aFrame->mPsdu == sTransmitPsdu[txBufIndex]);
 
+        EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), EFR32_RADIO_TRACE_TRANSMIT, iid, aFrame->mPsdu[IEEE802154_DSN_OFFSET]);
+        txStatsOnEnqueue(txBufIndex);
+
         if (!aFrame->mInfo.mTxInfo.mIsARetx)
         {
             sTransmitBuffer[txBufIndex].currentRadioTxPriority = SL_802154_RADIO_PRIO_TX_MIN;
@@ -1844,12 +3904,14 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
         }
 #endif
         updateIeInfoTxFrame(sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelayBaseTime
-                            + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay + SHR_DURATION_US);
+                            + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay + sPhyTiming.mShrDurationUs);
         // Note - we need to call this outside of txCurrentPacket as for Series 2,
         // this results in calling the SE interface from a critical section which is not permitted.
         radioProcessTransmitSecurity(&sCurrentTxPacket->frame, sCurrentTxPacket->iid);
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
+        txStatsOnTxIssued();
+
         CORE_DECLARE_IRQ_STATE;
         CORE_ENTER_ATOMIC();
         setInternalFlag(FLAG_ONGOING_TX_DATA, true);
@@ -1861,10 +3923,198 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
             otPlatRadioTxStarted(aInstance, aFrame);
         }
     }
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        txStatsOnEnqueueFailed(txBufIndex);
+    }
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void gpTransmitTimerHandler(struct sl_rail_multi_timer *tmr, sl_rail_time_t expectedTimeOfEvent, void *cbArg)
+{
+    OT_UNUSED_VARIABLE(tmr);
+    OT_UNUSED_VARIABLE(expectedTimeOfEvent);
+    OT_UNUSED_VARIABLE(cbArg);
+
+    sGpTransmitArmed = false;
+    sGpTransmitDue   = true;
+    otSysEventSignalPending();
+}
+
+// Hands the Green Power response over to RAIL, which starts it at its start time when that is still ahead.
+static otError gpTransmitStart(void)
+{
+    otError error;
+
+    OT_ASSERT(!isRadioTransmittingOrScanning());
+
+    sGpTransmitDue = false;
+
+    error = efr32RadioLoadChannelConfig(sGpTransmitBuffer.frame.mChannel, sGpTransmitPower);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    sGpTransmitBuffer.txAtStartTime =
+        ((int32_t)(sGpTransmitBuffer.txStartTime - sl_rail_get_time(SL_RAIL_EFR32_HANDLE)) > 0);
+
+    // GP responses are sent without CSMA.
+    setInternalFlag(RADIO_TX_EVENTS, false);
+    setInternalFlag(FLAG_CURRENT_TX_USE_CSMA, false);
+    sCurrentTxPacket = &sGpTransmitBuffer;
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    setInternalFlag(FLAG_ONGOING_TX_DATA, true);
+    tryTxCurrentPacket();
+    CORE_EXIT_ATOMIC();
+
+exit:
+    return error;
+}
+
+// Starts the Green Power response once it is due and the radio is free. A response which can no longer start in
+// its window is reported failed.
+static void gpTransmitProcess(void)
+{
+    otError error = OT_ERROR_CHANNEL_ACCESS_FAILURE;
+
+    otEXPECT(sGpTransmitDue && !isRadioTransmittingOrScanning());
+
+    if ((int32_t)(sl_rail_get_time(SL_RAIL_EFR32_HANDLE) - sGpTransmitDeadline) <= 0)
+    {
+        error = gpTransmitStart();
+    }
+
+    if (error != OT_ERROR_NONE)
+    {
+        sGpTransmitDue = false;
+        sl_gp_intf_tx_done(error);
+    }
+
+exit:
+    return;
+}
+
+otError efr32RadioTransmitGpFrame(otInstance    *aInstance,
+                                  const uint8_t *aPsdu,
+                                  uint8_t        aLength,
+                                  uint8_t        aChannel,
+                                  uint32_t       aTxTime,
+                                  uint32_t       aWindowUs)
+{
+    otError error = OT_ERROR_NONE;
+    int32_t delay;
+
+    OT_ASSERT(aLength <= IEEE802154_MAX_LENGTH);
+
+    // A single response is handled at a time, the caller retries with the next one once it is reported done.
+    otEXPECT_ACTION(!sGpTransmitArmed && !sGpTransmitDue
+                        && !(isRadioTransmittingOrScanning() && (sCurrentTxPacket == &sGpTransmitBuffer)),
+                    error = OT_ERROR_BUSY);
+
+    memcpy(sGpTransmitPsdu, aPsdu, aLength);
+    memset(&sGpTransmitBuffer.frame, 0, sizeof(sGpTransmitBuffer.frame));
+    sGpTransmitBuffer.frame.mPsdu            = sGpTransmitPsdu;
+    sGpTransmitBuffer.frame.mLength          = aLength;
+    sGpTransmitBuffer.frame.mChannel         = aChannel;
+    sGpTransmitBuffer.iid                    = efr32GetIidFromInstance(aInstance);
+    sGpTransmitBuffer.currentRadioTxPriority = SL_802154_RADIO_PRIO_TX_MIN;
+    sGpTransmitBuffer.txStartTime            = aTxTime;
+    sGpTransmitPower                         = sl_get_tx_power_for_current_channel(aInstance);
+    sGpTransmitDeadline                      = aTxTime + aWindowUs;
+
+    // The radio is only marked busy once the response is started, shortly before it is due.
+    delay = (int32_t)(aTxTime - sl_rail_get_time(SL_RAIL_EFR32_HANDLE));
+
+    if ((delay > GP_TRANSMIT_LEAD_TIME_US)
+        && (sl_rail_set_multi_timer(gRailHandle,
+                                    &sGpTransmitTimer,
+                                    (uint32_t)delay - GP_TRANSMIT_LEAD_TIME_US,
+                                    SL_RAIL_TIME_DELAY,
+                                    gpTransmitTimerHandler,
+                                    NULL)
+            == SL_RAIL_STATUS_NO_ERROR))
+    {
+        sGpTransmitArmed = true;
+    }
+    else if (!isRadioTransmittingOrScanning())
+    {
+        error = gpTransmitStart();
+    }
+    else
+    {
+        // Started by gpTransmitProcess() once the radio is free, or reported failed past its window.
+        sGpTransmitDue = true;
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+otError efr32RadioTransmitDiagFrame(otInstance    *aInstance,
+                                    const uint8_t *aPsdu,
+                                    uint8_t        aLength,
+                                    uint8_t        aChannel,
+                                    int8_t         aTxPower)
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_ASSERT(aLength <= IEEE802154_MAX_LENGTH);
+
+    otEXPECT_ACTION(!isRadioTransmittingOrScanning(), error = OT_ERROR_BUSY);
+
+    error = efr32RadioLoadChannelConfig(aChannel, aTxPower);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    memcpy(sDiagTransmitPsdu, aPsdu, aLength);
+    memset(&sDiagTransmitBuffer.frame, 0, sizeof(sDiagTransmitBuffer.frame));
+    sDiagTransmitBuffer.frame.mPsdu            = sDiagTransmitPsdu;
+    sDiagTransmitBuffer.frame.mLength          = aLength;
+    sDiagTransmitBuffer.frame.mChannel         = aChannel;
+    sDiagTransmitBuffer.iid                    = efr32GetIidFromInstance(aInstance);
+    sDiagTransmitBuffer.currentRadioTxPriority = SL_802154_RADIO_PRIO_TX_MIN;
+
+    // PER frames go out at a fixed pace, without CSMA.
+    setInternalFlag(RADIO_TX_EVENTS, false);
+    setInternalFlag(FLAG_CURRENT_TX_USE_CSMA, false);
+    sCurrentTxPacket = &sDiagTransmitBuffer;
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    setInternalFlag(FLAG_ONGOING_TX_DATA, true);
+    tryTxCurrentPacket();
+    CORE_EXIT_ATOMIC();
+
 exit:
     return error;
 }
 
+void efr32RadioSetRxFrameErrorCount(bool aEnable)
+{
+    sl_rail_events_t values = aEnable ? SL_RAIL_EVENT_RX_FRAME_ERROR : SL_RAIL_EVENTS_NONE;
+
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
+    // The stack event component needs the event whatever the diag does.
+    if (phyStackEventIsEnabled())
+    {
+        values = SL_RAIL_EVENT_RX_FRAME_ERROR;
+    }
+#endif
+
+    sRxFrameErrorCount = 0;
+    updateEvents(SL_RAIL_EVENT_RX_FRAME_ERROR, values);
+}
+
+uint32_t efr32RadioGetRxFrameErrorCount(void)
+{
+    return sRxFrameErrorCount;
+}
+#endif // OPENTHREAD_CONFIG_DIAG_ENABLE
+
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
 void updateIeInfoTxFrame(uint32_t shrTxTime)
@@ -1884,7 +4134,7 @@ void updateIeInfoTxFrame(uint32_t shrTxTime)
             (uint32_t)time; // Bottom 32 bits are sl_rail_get_time()
         sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay = SCHEDULE_TX_DELAY_US;
         time += sCurrentTxPacket->frame.mInfo.mTxInfo.mIeInfo->mNetworkTimeOffset
-                + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay + SHR_DURATION_US;
+                + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay + sPhyTiming.mShrDurationUs;
         *timeIe = sCurrentTxPacket->frame.mInfo.mTxInfo.mIeInfo->mTimeSyncSeq;
 
         *(++timeIe) = (uint8_t)(time & 0xff);
@@ -1913,8 +4163,9 @@ void txCurrentPacket(void)
     OT_ASSERT(getInternalFlag(FLAG_ONGOING_TX_DATA));
     OT_ASSERT(sCurrentTxPacket != NULL);
 
-    sl_rail_tx_options_t txOptions = SL_RAIL_TX_OPTIONS_DEFAULT;
-    sl_rail_status_t     status    = SL_RAIL_STATUS_INVALID_STATE;
+    sl_rail_tx_options_t txOptions  = SL_RAIL_TX_OPTIONS_DEFAULT;
+    sl_rail_status_t     status     = SL_RAIL_STATUS_INVALID_STATE;
+    uint32_t             benchStart = radioBenchStart();
     uint8_t              frameLength;
     bool                 ackRequested;
 
@@ -1961,14 +4212,7 @@ void txCurrentPacket(void)
 
 #if RADIO_CONFIG_DMP_SUPPORT
         // time we wait for ACK
-        if (sl_rail_get_symbol_rate(gRailHandle) > 0)
-        {
-            txSchedulerInfo.transaction_time += (sl_rail_time_t)(12 * 1e6 / sl_rail_get_symbol_rate(gRailHandle));
-        }
-        else
-        {
-            txSchedulerInfo.transaction_time += 12 * RADIO_TIMING_DEFAULT_SYMBOLTIME_US;
-        }
+        txSchedulerInfo.transaction_time += sPhyTiming.mAckWaitUs;
 #endif
     }
 
@@ -1986,16 +4230,9 @@ void txCurrentPacket(void)
 
 #if RADIO_CONFIG_DMP_SUPPORT
     // time needed for the frame itself
-    // 4B preamble, 1B SFD, 1B PHR is not counted in frameLength
-    if (sl_rail_get_bit_rate(gRailHandle) > 0)
-    {
-        txSchedulerInfo.transaction_time +=
-            (sl_rail_time_t)((frameLength + 4 + 1 + 1) * 8 * 1e6 / sl_rail_get_bit_rate(gRailHandle));
-    }
-    else
-    { // assume 250kbps
-        txSchedulerInfo.transaction_time += (frameLength + 4 + 1 + 1) * RADIO_TIMING_DEFAULT_BYTETIME_US;
-    }
+    // SHR and PHR are not counted in frameLength
+    txSchedulerInfo.transaction_time +=
+        sPhyTiming.mShrDurationUs + sPhyTiming.mPhrDurationUs + efr32PhyBytesToUs(frameLength);
 #endif
 
     // Prioritize the Tx over schedule Rx to avoid missing data check-ins such as data polls.
@@ -2005,13 +4242,32 @@ void txCurrentPacket(void)
         setInternalFlag(FLAG_SCHEDULED_RX_PENDING | EVENT_SCHEDULED_RX_STARTED, false);
     }
 
-    if (sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay == 0)
+    if (sCurrentTxPacket->txAtStartTime)
+    {
+        // Frames of the radio driver, such as Green Power responses, go out at their start time without CCA.
+        sl_rail_scheduled_tx_config_t startTxOptions = {.when         = sCurrentTxPacket->txStartTime,
+                                                        .mode         = SL_RAIL_TIME_ABSOLUTE,
+                                                        .tx_during_rx = SL_RAIL_SCHEDULED_TX_DURING_RX_POSTPONE_TX};
+
+        status = sl_rail_start_scheduled_tx(gRailHandle,
+                                            sCurrentTxPacket->frame.mChannel,
+                                            txOptions,
+                                            &startTxOptions,
+                                            &txSchedulerInfo);
+
+        if (status == SL_RAIL_STATUS_NO_ERROR)
+        {
+            setInternalFlag(FLAG_SCHEDULED_TX_PENDING, true);
+            (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_STARTED, 0U);
+        }
+    }
+    else if (sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay == 0)
     {
         if (getInternalFlag(FLAG_CURRENT_TX_USE_CSMA))
         {
 #if RADIO_CONFIG_DMP_SUPPORT
             // time needed for CSMA/CA
-            txSchedulerInfo.transaction_time += RADIO_TIMING_CSMA_OVERHEAD_US;
+            txSchedulerInfo.transaction_time += sPhyTiming.mCsmaOverheadUs;
 #endif
             csmaConfig.csma_tries        = sCurrentTxPacket->frame.mInfo.mTxInfo.mMaxCsmaBackoffs;
             csmaConfig.cca_threshold_dbm = sCcaThresholdDbm;
@@ -2049,7 +4305,7 @@ void txCurrentPacket(void)
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
         sl_rail_scheduled_tx_config_t scheduleTxOptions = {
             .when = sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelayBaseTime
-                    + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay - SHR_DURATION_US,
+                    + sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay - sPhyTiming.mShrDurationUs,
             .mode         = SL_RAIL_TIME_ABSOLUTE,
             .tx_during_rx = SL_RAIL_SCHEDULED_TX_DURING_RX_POSTPONE_TX};
 
@@ -2093,6 +4349,8 @@ void txCurrentPacket(void)
 
         otSysEventSignalPending();
     }
+
+    radioBenchStop(EFR32_RADIO_BENCH_TX_START, benchStart);
 }
 
 // This API gets called from init procedure so instance to IID mapping does not exist
@@ -2185,6 +4443,9 @@ void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
     otEXPECT(sl_ot_rtos_task_can_access_pal());
     sPromiscuous = aEnable;
 
+    // The sniffer capture keeps the radio promiscuous, the setting is applied once it stops.
+    otEXPECT(!sSnifferCaptureActive);
+
     status = sl_rail_ieee802154_set_promiscuous_mode(gRailHandle, aEnable);
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
 
@@ -2253,6 +4514,11 @@ otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aTh
     otEXPECT_ACTION(sl_ot_rtos_task_can_access_pal(), error = OT_ERROR_REJECTED);
     sCcaThresholdDbm = aThreshold;
 
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+    // A threshold chosen by the host takes precedence over the adaptive controller.
+    sAdaptiveCcaEnabled = false;
+#endif
+
 exit:
     return error;
 }
@@ -2417,6 +4683,23 @@ otError otPlatRadioEnableCsl(otInstance         *aInstance,
 
     sCslPeriod = aCslPeriod;
 
+#if SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+    // The drift learned against the previous parent does not apply to a new one.
+    if ((aCslPeriod == 0) || (aExtAddr == NULL) || (memcmp(aExtAddr, &sCslDriftParent, sizeof(otExtAddress)) != 0))
+    {
+        cslDriftReset();
+        memset(&sCslDriftParent, 0, sizeof(sCslDriftParent));
+
+        if (aExtAddr != NULL)
+        {
+            sCslDriftParent = *aExtAddr;
+        }
+    }
+
+    // The parent keeps its extended address when its short address changes.
+    sCslDriftParentShort = aShortAddr;
+#endif
+
 exit:
     return error;
 }
@@ -2437,7 +4720,11 @@ uint8_t otPlatRadioGetCslAccuracy(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE && SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+    return cslDriftGetAccuracy(otPlatTimeGetXtalAccuracy());
+#else
     return otPlatTimeGetXtalAccuracy();
+#endif
 }
 
 uint8_t otPlatRadioGetCslUncertainty(otInstance *aInstance)
@@ -2525,6 +4812,8 @@ static bool writeIeee802154EnhancedAck(sl_rail_handle_t          aRailHandle,
 
     otRadioFrame receivedFrame, enhAckFrame;
     uint8_t      enhAckPsdu[IEEE802154_MAX_LENGTH];
+    uint8_t      iid           = INVALID_INTERFACE_INDEX;
+    bool         enhAckWritten = false;
 
 #define EARLY_FRAME_PENDING_EXPECTED_BYTES (2U + 2U + 1U + 2U + 8U + 2U + 8U + 14U)
 #define FINAL_PACKET_LENGTH_WITH_IE (EARLY_FRAME_PENDING_EXPECTED_BYTES + OT_ACK_IE_MAX_SIZE)
@@ -2537,8 +4826,6 @@ static bool writeIeee802154EnhancedAck(sl_rail_handle_t          aRailHandle,
                                                  receivedPsdu,
                                                  FINAL_PACKET_LENGTH_WITH_IE);
 
-    uint8_t iid = INVALID_INTERFACE_INDEX;
-
     if (*initialPktReadBytes == 0U)
     {
         return true; // Nothing to read, which means generating an immediate ACK is also pointless
@@ -2595,18 +4882,11 @@ static bool writeIeee802154EnhancedAck(sl_rail_handle_t          aRailHandle,
     {
         // Calculate time in the future where the SHR is done being sent out
         uint32_t ackShrDoneTime = // Currently partially received packet's SHR time
-            (rxTimestamp
-             - (packetInfoForEnhAck->packet_bytes * OT_RADIO_SYMBOL_TIME * 2)
-             // PHR of this packet
-             + (PHY_HEADER_SIZE * OT_RADIO_SYMBOL_TIME * 2)
+            (rxTimestamp - efr32PhyBytesToUs(packetInfoForEnhAck->packet_bytes)
              // Received frame's expected time in the PHR
-             + (receivedFrame.mLength * OT_RADIO_SYMBOL_TIME * 2)
-             // rxToTx turnaround time
-             + sRailIeee802154Config.timings.rx_to_tx
-             // PHR time of the ACK
-             + (PHY_HEADER_SIZE * OT_RADIO_SYMBOL_TIME * 2)
-             // SHR time of the ACK
-             + (SHR_SIZE * OT_RADIO_SYMBOL_TIME * 2));
+             + efr32PhyBytesToUs(receivedFrame.mLength)
+             // PHR of this packet, rxToTx turnaround time, PHR and SHR time of the ACK
+             + sPhyTiming.mEnhAckShrOffsetUs);
 
         // Update IE data in the 802.15.4 header with the newest CSL period / phase
         otMacFrameSetCslIe(&enhAckFrame, (uint16_t)sCslPeriod, getCslPhase(ackShrDoneTime));
@@ -2656,8 +4936,14 @@ static bool writeIeee802154EnhancedAck(sl_rail_handle_t          aRailHandle,
 #else
     otEXPECT(enhAckStatus == SL_RAIL_STATUS_NO_ERROR);
 #endif
+    enhAckWritten = true;
 
 exit:
+    // The interface is only known once the frame is found to need an Enh-ACK.
+    if (!enhAckWritten && (iid != INVALID_INTERFACE_INDEX))
+    {
+        radioCountersOnEnhAckFailed(iid);
+    }
     return true;
 }
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
@@ -2758,7 +5044,8 @@ static void packetReceivedCallback(void)
     uint16_t                    length            = 0;
     bool                        framePendingInAck = false;
     bool                        dropPacket        = false;
-    uint8_t                     iid               = 0;
+    uint8_t                     iid               = INVALID_INTERFACE_INDEX;
+    uint8_t                     rxChannel         = sReceive.frame.mChannel;
     sl_status_t                 status;
     bool                        isRxPacketQueued;
     rxBuffer                   *rxPacketBuf = NULL;
@@ -2770,6 +5057,7 @@ static void packetReceivedCallback(void)
                     dropPacket = true);
 
     otEXPECT_ACTION(validatePacketDetails(packetHandle, &packetDetails, &packetInfo, &length), dropPacket = true);
+    rxChannel = (uint8_t)packetDetails.channel;
 
     otEXPECT_ACTION((skipRxPacketLengthBytes(&packetInfo)) == OT_ERROR_NONE, dropPacket = true);
 
@@ -2778,6 +5066,21 @@ static void packetReceivedCallback(void)
 
     iid = getIidFromFilterMask(packetInfo.filter_mask);
 
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+    if (sSnifferCaptureActive)
+    {
+        snifferCaptureRxPacket(&packetInfo, &packetDetails, length);
+
+        // Only an ACK to a frame sent while capturing still goes to the stack.
+        if (!packetDetails.is_ack)
+        {
+            radioCountersOnRx(rxChannel, iid, true);
+            (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_ENDED, (uint32_t)isReceivingFrame());
+            ExitNow();
+        }
+    }
+#endif
+
     if (packetDetails.is_ack)
     {
         otEXPECT_ACTION(
@@ -2806,6 +5109,7 @@ static void packetReceivedCallback(void)
 
             // Processing the ACK frame in ISR context avoids the Tx state to be messed up,
             // in case the Rx FIFO queue gets wiped out in a DMP situation.
+            txStatsOnAckReceived();
             setInternalFlag(EVENT_TX_SUCCESS, true);
             setInternalFlag(FLAG_WAITING_FOR_ACK | FLAG_ONGOING_TX_DATA | EVENT_SCHEDULED_TX_STARTED, false);
 
@@ -2840,17 +5144,19 @@ static void packetReceivedCallback(void)
         // read packet
         sl_rail_copy_rx_packet(gRailHandle, rxPacketBuf->psdu, &packetInfo);
 
-        rxPacketBuf->packetInfo.length    = (uint8_t)length;
-        rxPacketBuf->packetInfo.channel   = (uint8_t)packetDetails.channel;
-        rxPacketBuf->packetInfo.rssi      = packetDetails.rssi_dbm;
-        rxPacketBuf->packetInfo.lqi       = packetDetails.lqi;
-        rxPacketBuf->packetInfo.timestamp = packetDetails.time_received.packet_time;
-        rxPacketBuf->packetInfo.iid       = iid;
+        rxPacketBuf->packetInfo.length      = (uint8_t)length;
+        rxPacketBuf->packetInfo.channel     = (uint8_t)packetDetails.channel;
+        rxPacketBuf->packetInfo.rssi        = packetDetails.rssi_dbm;
+        rxPacketBuf->packetInfo.lqi         = packetDetails.lqi;
+        rxPacketBuf->packetInfo.timestamp   = packetDetails.time_received.packet_time;
+        rxPacketBuf->packetInfo.iid         = iid;
+        rxPacketBuf->packetInfo.scheduledRx = getInternalFlag(EVENT_SCHEDULED_RX_STARTED);
 
         // Queue the rx packet or drop it if queueing fails and free the memory block.
         isRxPacketQueued = queueAdd(&sRxPacketQueue, (void *)rxPacketBuf);
         otEXPECT_ACTION(isRxPacketQueued, dropPacket = true);
 
+        radioCountersOnRx(rxPacketBuf->packetInfo.channel, iid, true);
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
         railDebugCounters.mRailPlatRadioReceiveProcessedCount++;
 #endif
@@ -2878,6 +5184,9 @@ static void packetReceivedCallback(void)
 exit:
     if (dropPacket)
     {
+        // The channel is unknown when the packet details could not be read, count it on the receive channel.
+        radioCountersOnRx(rxChannel, iid, false);
+        radioBenchOnRxDropped(false);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_CORRUPTED, (uint32_t)isReceivingFrame());
 
         IgnoreError(sl_memory_pool_free(&sRxPacketMemPoolHandle, rxPacketBuf));
@@ -2982,6 +5291,7 @@ static void schedulerEventCallback(sl_rail_handle_t aRailHandle)
     sl_rail_scheduler_status_t scheduler_status;
     sl_rail_status_t           rail_status;
     sl_rail_get_scheduler_status(aRailHandle, &scheduler_status, &rail_status);
+    EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), EFR32_RADIO_TRACE_SCHEDULER_STATUS, 0, scheduler_status);
     if (scheduler_status != SL_RAIL_SCHEDULER_STATUS_NO_ERROR)
     {
         setInternalFlag(FLAG_SCHEDULED_RX_PENDING | FLAG_SCHEDULED_TX_PENDING | EVENT_SCHEDULED_TX_STARTED, false);
@@ -3013,12 +5323,15 @@ static void schedulerEventCallback(sl_rail_handle_t aRailHandle)
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
 static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvents)
 {
-#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
+    uint32_t benchStart = radioBenchStart();
+
     if (aEvents & (SL_RAIL_EVENT_RX_SYNC_0_DETECT | SL_RAIL_EVENT_RX_SYNC_1_DETECT))
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_SYNC);
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_STARTED, (uint32_t)isReceivingFrame());
-    }
 #endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
+    }
 
 #ifdef SL_CATALOG_RAIL_UTIL_COEX_PRESENT
     if (aEvents & SL_RAIL_EVENT_SIGNAL_DETECTED)
@@ -3033,55 +5346,74 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
 #endif // SL_CATALOG_RAIL_UTIL_COEX_PRESENT
     )
     {
+        uint32_t ackBenchStart = radioBenchStart();
+
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_DATA_REQUEST);
         dataRequestCommandCallback(aRailHandle);
+        radioBenchStop(EFR32_RADIO_BENCH_ACK, ackBenchStart);
     }
 
-#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
     if (aEvents & SL_RAIL_EVENT_RX_FILTER_PASSED)
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_FILTER_PASSED);
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_ACCEPTED, (uint32_t)isReceivingFrame());
-    }
 #endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
+    }
 
     if (aEvents & SL_RAIL_EVENT_TX_PACKET_SENT)
     {
+        RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_PACKET_SENT);
+        txStatsOnPacketSent();
         packetSentCallback(false);
     }
     else if (aEvents & SL_RAIL_EVENT_TX_CHANNEL_BUSY)
     {
+        RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_CHANNEL_BUSY);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_BLOCKED, (uint32_t)txWaitingForAck());
         txFailedCallback(false, EVENT_TX_CCA_FAILED);
     }
     else if (aEvents & SL_RAIL_EVENT_TX_BLOCKED)
     {
+        RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_BLOCKED);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_BLOCKED, (uint32_t)txWaitingForAck());
         txFailedCallback(false, EVENT_TX_FAILED);
     }
     else if (aEvents & (SL_RAIL_EVENT_TX_UNDERFLOW | SL_RAIL_EVENT_TX_ABORTED))
     {
+        RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_ABORTED);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_ABORTED, (uint32_t)txWaitingForAck());
         txFailedCallback(false, EVENT_TX_FAILED);
     }
     else
     {
         // Pre-completion aEvents are processed in their logical order:
-#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
         if (aEvents & SL_RAIL_EVENT_TX_START_CCA)
         {
             // We are starting RXWARM for a CCA check
+            RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_START_CCA);
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
             (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_CCA_SOON, 0U);
+#endif
         }
         if (aEvents & SL_RAIL_EVENT_TX_CCA_RETRY)
         {
             // We failed a CCA check and need to retry
+            RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_CCA_RETRY);
+            txStatsOnCcaRetry();
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
             (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_CCA_BUSY, 0U);
+#endif
         }
         if (aEvents & SL_RAIL_EVENT_TX_CHANNEL_CLEAR)
         {
             // We're going on-air
+            RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_STARTED);
+            txStatsOnTxStarted();
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
             (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TX_STARTED, 0U);
+#endif
         }
-#endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
     }
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -3096,6 +5428,7 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
     {
         if (aEvents & SL_RAIL_EVENT_RX_SCHEDULED_RX_STARTED)
         {
+            RADIO_TRACE_RX(EFR32_RADIO_TRACE_SCHEDULED_RX_STARTED);
             setInternalFlag(EVENT_SCHEDULED_RX_STARTED, true);
         }
 
@@ -3103,6 +5436,8 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
         // If we miss a scheduled receive, let application schedule another.
         if (aEvents & SL_RAIL_EVENT_RX_SCHEDULED_RX_END || aEvents & SL_RAIL_EVENT_RX_SCHEDULED_RX_MISSED)
         {
+            RADIO_TRACE_RX(EFR32_RADIO_TRACE_SCHEDULED_RX_END);
+            sRxWindowEnded = ((aEvents & SL_RAIL_EVENT_RX_SCHEDULED_RX_END) != 0);
             setInternalFlag(FLAG_SCHEDULED_RX_PENDING | EVENT_SCHEDULED_RX_STARTED, false);
             radioSetIdle();
         }
@@ -3111,6 +5446,8 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
     {
         if (aEvents & SL_RAIL_EVENT_TX_SCHEDULED_TX_STARTED)
         {
+            RADIO_TRACE_TX(EFR32_RADIO_TRACE_SCHEDULED_TX_STARTED);
+            txStatsOnTxStarted();
             setInternalFlag(EVENT_SCHEDULED_TX_STARTED, true);
             setInternalFlag(FLAG_SCHEDULED_TX_PENDING, false);
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
@@ -3119,6 +5456,8 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
         }
         else if (aEvents & SL_RAIL_EVENT_TX_SCHEDULED_TX_MISSED)
         {
+            RADIO_TRACE_TX(EFR32_RADIO_TRACE_SCHEDULED_TX_MISSED);
+            txStatsOnScheduledTxMissed();
             setInternalFlag(FLAG_SCHEDULED_TX_PENDING, false);
             txFailedCallback(false, EVENT_TX_SCHEDULER_ERROR);
         }
@@ -3127,37 +5466,61 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
 
     if (aEvents & SL_RAIL_EVENT_RX_PACKET_RECEIVED)
     {
+        uint32_t rxBenchStart = radioBenchStart();
+
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_PACKET_RECEIVED);
         packetReceivedCallback();
+        radioBenchStop(EFR32_RADIO_BENCH_RX_ISR, rxBenchStart);
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
         railDebugCounters.mRailEventPacketReceived++;
 #endif
     }
 
-#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
     if (aEvents & SL_RAIL_EVENT_RX_FRAME_ERROR)
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_FRAME_ERROR);
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+        sRxFrameErrorCount++;
+#endif
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_CORRUPTED, (uint32_t)isReceivingFrame());
+#endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
     }
     // The following 3 events cause us to not receive a packet
     if (aEvents
         & (SL_RAIL_EVENT_RX_PACKET_ABORTED | SL_RAIL_EVENT_RX_ADDRESS_FILTERED | SL_RAIL_EVENT_RX_FIFO_OVERFLOW))
     {
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+        if ((aEvents & SL_RAIL_EVENT_RX_FIFO_OVERFLOW) && sSnifferCaptureActive)
+        {
+            efr32SnifferCaptureOnRxOverflow();
+        }
+#endif
+        if (aEvents & SL_RAIL_EVENT_RX_FIFO_OVERFLOW)
+        {
+            radioBenchOnRxDropped(true);
+        }
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_RX_FILTERED);
+#ifdef SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_FILTERED, (uint32_t)isReceivingFrame());
-    }
 #endif // SL_CATALOG_RAIL_UTIL_IEEE802154_STACK_EVENT_PRESENT
+    }
 
     if (aEvents & SL_RAIL_EVENT_TXACK_PACKET_SENT)
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_TXACK_SENT);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_ACK_SENT, (uint32_t)isReceivingFrame());
         packetSentCallback(true);
     }
     if (aEvents & (SL_RAIL_EVENT_TXACK_ABORTED | SL_RAIL_EVENT_TXACK_UNDERFLOW))
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_TXACK_FAILED);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_ACK_ABORTED, (uint32_t)isReceivingFrame());
         txFailedCallback(true, 0xFF);
     }
     if (aEvents & SL_RAIL_EVENT_TXACK_BLOCKED)
     {
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_TXACK_FAILED);
         (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_RX_ACK_BLOCKED, (uint32_t)isReceivingFrame());
         txFailedCallback(true, 0xFF);
     }
@@ -3166,6 +5529,7 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
     // the ACK to win over the timeout.
     if ((aEvents & SL_RAIL_EVENT_RX_ACK_TIMEOUT) && (getInternalFlag(FLAG_WAITING_FOR_ACK)))
     {
+        RADIO_TRACE_TX(EFR32_RADIO_TRACE_TX_ACK_TIMEOUT);
         ackTimeoutCallback();
     }
 
@@ -3193,6 +5557,8 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
     {
         sl_rail_status_t status;
 
+        RADIO_TRACE_RX(EFR32_RADIO_TRACE_CAL_NEEDED);
+
         status = sl_rail_calibrate(aRailHandle, NULL, SL_RAIL_CAL_ALL_PENDING);
         // TODO: Non-RTOS DMP case fails
 #if (!defined(SL_CATALOG_BLUETOOTH_PRESENT) || defined(SL_CATALOG_KERNEL_PRESENT))
@@ -3216,6 +5582,8 @@ static void RAILCb_Generic(sl_rail_handle_t aRailHandle, sl_rail_events_t aEvent
     {
         otSysEventSignalPending();
     }
+
+    radioBenchStop(EFR32_RADIO_BENCH_RAIL_CALLBACK, benchStart);
 }
 
 //------------------------------------------------------------------------------
@@ -3324,7 +5692,7 @@ otError otPlatMultipanSetActiveInstance(otInstance *aInstance, bool aCompletePen
 }
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
-static void updateRxFrameTimestamp(bool aIsAckFrame, sl_rail_time_t aTimestamp)
+static uint64_t railTimeToPlatTime(sl_rail_time_t aTimestamp)
 {
     // Current time > sync-receive timestamp
     // Therefore lower 32 bits of current time should always be greater than lower 32 bits
@@ -3340,13 +5708,19 @@ static void updateRxFrameTimestamp(bool aIsAckFrame, sl_rail_time_t aTimestamp)
         railUsTimerWraps--;
     }
 
+    return aTimestamp + ((uint64_t)railUsTimerWraps << 32);
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+static void updateRxFrameTimestamp(bool aIsAckFrame, sl_rail_time_t aTimestamp)
+{
     if (aIsAckFrame)
     {
-        sReceiveAck.frame.mInfo.mRxInfo.mTimestamp = aTimestamp + ((uint64_t)railUsTimerWraps << 32);
+        sReceiveAck.frame.mInfo.mRxInfo.mTimestamp = railTimeToPlatTime(aTimestamp);
     }
     else
     {
-        sReceive.frame.mInfo.mRxInfo.mTimestamp = aTimestamp + ((uint64_t)railUsTimerWraps << 32);
+        sReceive.frame.mInfo.mRxInfo.mTimestamp = railTimeToPlatTime(aTimestamp);
     }
 }
 
@@ -3414,6 +5788,14 @@ static rxBuffer *prepareNextRxPacketforCb(void)
 #endif
 
     updateRxFrameTimestamp(false, rxPacketBuf->packetInfo.timestamp);
+
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE && SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE
+    if (rxPacketBuf->packetInfo.scheduledRx)
+    {
+        cslDriftOnScheduledRx(&sReceive.frame, rxPacketBuf->packetInfo.timestamp);
+    }
+#endif
+
     return rxPacketBuf;
 }
 
@@ -3430,6 +5812,12 @@ static void processNextRxPacket(otInstance *aInstance)
     // sReceive buffer gets populated from prepareNextRxPacketforCb.
     interfaceId = sReceive.iid;
 
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+    // The frame is checked once, whatever the number of instances it is delivered to. A GP frame may
+    // trigger the response buffered by a host.
+    sl_gp_intf_process_rx_pkt(&sReceive.frame);
+#endif
+
     // Submit broadcast packet to all initilized instances.
     do
     {
@@ -3443,31 +5831,14 @@ static void processNextRxPacket(otInstance *aInstance)
         {
             continue;
         }
+        EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), EFR32_RADIO_TRACE_RECEIVE_DONE, sReceive.iid, sReceiveError);
         otPlatRadioReceiveDone(instance, &sReceive.frame, sReceiveError);
-        {
-            bool isGpPacket = sl_gp_intf_is_gp_pkt(&sReceive.frame);
-#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-            // For multipan RCP, continue normal processing.
-            OT_UNUSED_VARIABLE(isGpPacket);
-#else
-            // Else, we should not receive GP packets.
-            otEXPECT(!isGpPacket);
-#endif
-
-#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-            (void)sl_gp_intf_should_buffer_pkt(instance, &sReceive.frame, true);
-#endif
-            otPlatRadioReceiveDone(instance, &sReceive.frame, sReceiveError);
-        }
     } while (sReceive.iid == RADIO_BCAST_IID && interfaceId < RADIO_INTERFACE_COUNT);
 
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
     railDebugCounters.mRailPlatRadioReceiveDoneCbCount++;
 #endif
 
-#if !OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-exit:
-#endif
     IgnoreError(sl_memory_pool_free(&sRxPacketMemPoolHandle, rxPacketBuf));
     otSysEventSignalPending();
 }
@@ -3476,15 +5847,43 @@ static void processRxPackets(otInstance *aInstance)
 {
     while (!queueIsEmpty(&sRxPacketQueue))
     {
+        uint32_t benchStart = radioBenchStart();
+
         processNextRxPacket(aInstance);
+        radioBenchStop(EFR32_RADIO_BENCH_RX_DELIVERY, benchStart);
     }
 }
 
+// Reports the completion of the current transmission to whoever requested it.
+static void reportTxDone(otInstance *aInstance, otRadioFrame *aAckFrame, otError aTxStatus)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+    // Frames of the diag PER test are not known to the stack.
+    otEXPECT_ACTION(sCurrentTxPacket != &sDiagTransmitBuffer, efr32DiagTxDone(aTxStatus));
+#endif
+
+#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+    otEXPECT_ACTION(sCurrentTxPacket != &sGpTransmitBuffer, sl_gp_intf_tx_done(aTxStatus));
+    otPlatRadioTxDone(otPlatMultipanIidToInstance(sCurrentTxPacket->iid),
+                      &sCurrentTxPacket->frame,
+                      aAckFrame,
+                      aTxStatus);
+#else
+    otPlatRadioTxDone(aInstance, &sCurrentTxPacket->frame, aAckFrame, aTxStatus);
+#endif
+
+exit:
+    return;
+}
+
 static void processTxComplete(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
     otError       txStatus;
-    otRadioFrame *ackFrame = NULL;
+    otRadioFrame *ackFrame   = NULL;
+    uint32_t      benchStart = radioBenchStart();
 
     if (getInternalFlag(RADIO_TX_EVENTS))
     {
@@ -3520,16 +5919,23 @@ static void processTxComplete(otInstance *aInstance)
             otLogDebgPlat("Transmit failed ErrorCode=%d", txStatus);
         }
 
+#if SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE
+        adaptiveCcaUpdate(txStatus);
+#endif
+
         // Clear any internally-set txDelays so future transmits are not affected.
         sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelayBaseTime = 0;
         sCurrentTxPacket->frame.mInfo.mTxInfo.mTxDelay         = 0;
+
+        EFR32_RADIO_TRACE(RADIO_TRACE_NOW(), EFR32_RADIO_TRACE_TX_DONE, sCurrentTxPacket->iid, txStatus);
+        txStatsOnTxDone(txStatus);
+        radioCountersOnTxDone(txStatus);
+        // The upper layer handling of the completion is not accounted, it may start the next transmission.
+        radioBenchStop(EFR32_RADIO_BENCH_TX_DONE, benchStart);
+        reportTxDone(aInstance, ackFrame, txStatus);
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-        otPlatRadioTxDone(otPlatMultipanIidToInstance(sCurrentTxPacket->iid),
-                          &sCurrentTxPacket->frame,
-                          ackFrame,
-                          txStatus);
-#else
-        otPlatRadioTxDone(aInstance, &sCurrentTxPacket->frame, ackFrame, txStatus);
+        // Start the next deferred command right away, rather than after the receive and energy scan processing.
+        processPendingCommands();
 #endif
 
 #if RADIO_CONFIG_DEBUG_COUNTERS_SUPPORT
@@ -3539,40 +5945,6 @@ static void processTxComplete(otInstance *aInstance)
     }
 }
 
-#if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-static inline void processPendingCommands(void)
-{
-    // Check and process pending transmit and energy scan commands if radio is not busy.
-    if (!queueIsEmpty(&sPendingCommandQueue) && (!isRadioTransmittingOrScanning()))
-    {
-        // Dequeue the pending command
-        pendingCommandEntry *pendingCommand = (pendingCommandEntry *)queueRemove(&sPendingCommandQueue);
-        OT_ASSERT(pendingCommand != NULL);
-        uint8_t iid = pendingCommand->iid;
-
-        switch (pendingCommand->cmdType)
-        {
-        case kPendingCommandTypeTransmit:
-            otPlatRadioTransmit(otPlatMultipanIidToInstance(iid), pendingCommand->request.txFrame);
-            break;
-
-        case kPendingCommandTypeEnergyScan:
-            otPlatRadioEnergyScan(otPlatMultipanIidToInstance(iid),
-                                  pendingCommand->request.energyScan.scanChannel,
-                                  pendingCommand->request.energyScan.scanDuration);
-            break;
-
-        default:
-            OT_ASSERT(false);
-            break;
-        }
-
-        // Free the allocated memory.
-        sl_free(pendingCommand);
-    }
-}
-#endif // OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-
 void efr32RadioProcess(otInstance *aInstance)
 {
     (void)handlePhyStackEvent(SL_RAIL_UTIL_IEEE802154_STACK_EVENT_TICK, 0U);
@@ -3598,10 +5970,31 @@ void efr32RadioProcess(otInstance *aInstance)
         railDebugCounters.mRailEventEnergyScanCompleted++;
 #endif
     }
+    else if (sEnergyScanMode == ENERGY_SCAN_MODE_SWEEP && sEnergyScanStatus == ENERGY_SCAN_STATUS_COMPLETED)
+    {
+        sEnergyScanStatus = ENERGY_SCAN_STATUS_IDLE;
+
+        // Return to the state the radio was in before the sweep.
+        if (sEnergySweepResumeRx)
+        {
+            (void)radioSetRx(sReceive.frame.mChannel);
+        }
+        else
+        {
+            radioSetIdle();
+        }
+
+        otPlatRadioExtensionEnergySweepDone(sEnergySweepResultCount);
+        otSysEventSignalPending();
+    }
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     processPendingCommands();
 #endif // OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    rxWindowProcess();
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -37,20 +37,55 @@
 #include <stdbool.h>
 #include <stdio.h>
 
+#include "em_core.h"
+#include "platform-efr32.h"
 #include "radio_coex.h"
 
 #if OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
 
+#define COEX_DIRECTION_RX 0
+#define COEX_DIRECTION_TX 1
+
 static sl_ot_coex_counter_t sl_coex_counter;
 
-#define SL_INCREMENT_IF_NO_OVERFLOW(var, val, incr)                            \
-    do                                                                         \
-    {                                                                          \
-        uint32_t temp = val + incr;                                            \
-        otEXPECT_ACTION(temp >= var, sl_coex_counter.metrics.mStopped = true); \
-        var = temp;                                                            \
+// Request timestamps are kept per direction, a rx request may be pending while a tx request is made.
+static uint32_t                  sCoexRequestTimestamp[2];
+static efr32CoexLatencyHistogram sCoexLatencyHistogram[2];
+static efr32CoexEvent            sCoexEvents[SL_OPENTHREAD_COEX_EVENT_RING_SIZE];
+static uint32_t                  sCoexEventCount;
+
+// Counters saturate instead of wrapping, so that they stay meaningful on long running devices.
+#define SL_INCREMENT_SATURATING(var, incr)                                         \
+    do                                                                             \
+    {                                                                              \
+        uint32_t increment = (incr);                                               \
+        (var) = ((var) > UINT32_MAX - increment) ? UINT32_MAX : (var) + increment; \
     } while (0)
 
+static void coexRecordLatency(uint8_t aDirection, uint32_t aLatencyUs)
+{
+    efr32CoexLatencyHistogram *histogram = &sCoexLatencyHistogram[aDirection];
+    uint8_t                    bin       = efr32LatencyHistogramBin(aLatencyUs, EFR32_COEX_LATENCY_HISTOGRAM_BIN_COUNT);
+
+    SL_INCREMENT_SATURATING(histogram->mBins[bin], 1);
+
+    if (aLatencyUs > histogram->mMaxUs)
+    {
+        histogram->mMaxUs = aLatencyUs;
+    }
+}
+
+static void coexRecordEvent(uint8_t aEvent, uint8_t aDirection, uint32_t aTimestampUs, uint32_t aLatencyUs)
+{
+    efr32CoexEvent *entry = &sCoexEvents[sCoexEventCount % SL_OPENTHREAD_COEX_EVENT_RING_SIZE];
+
+    entry->mTimestampUs = aTimestampUs;
+    entry->mLatencyUs   = aLatencyUs;
+    entry->mEvent       = aEvent;
+    entry->mIsTx        = (aDirection == COEX_DIRECTION_TX);
+    sCoexEventCount++;
+}
+
 void sl_rail_util_coex_ot_events(sl_rail_util_coex_ot_event_t event)
 {
     bool                         isTxEvent = (event & SL_RAIL_UTIL_COEX_OT_TX_REQUEST);
@@ -59,6 +94,9 @@ void sl_rail_util_coex_ot_events(sl_rail_util_coex_ot_event_t event)
     uint32_t *metrics = (isTxEvent) ? &sl_coex_counter.metrics.mNumTxRequest : &sl_coex_counter.metrics.mNumRxRequest;
     uint64_t *totalReqToGrantDuration =
         (isTxEvent) ? &sl_coex_counter.totalTxReqToGrantDuration : &sl_coex_counter.totalRxReqToGrantDuration;
+    uint8_t  direction          = isTxEvent ? COEX_DIRECTION_TX : COEX_DIRECTION_RX;
+    uint32_t now                = otPlatAlarmMicroGetNow();
+    uint32_t reqToGrantDuration = 0;
 
     /* clang-format off */
 
@@ -89,62 +127,50 @@ void sl_rail_util_coex_ot_events(sl_rail_util_coex_ot_event_t event)
     // uint32_t mAvgRxRequestToGrantTime;              ///< Average time in usec from rx request to grant.
     
     // uint32_t mNumRxGrantNone;                       ///< Number of rx requests that completed without receiving grant.
-    // bool     mStopped;
+    // bool     mStopped;                              ///< Never set, counters saturate instead.
 
     /* clang-format on */
 
-    otEXPECT(sl_coex_counter.metrics.mStopped == false);
-
     switch (coexEvent)
     {
     case SL_RAIL_UTIL_COEX_OT_EVENT_GRANTED_IMMEDIATE:
     {
-        SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_GRANT_IMMEDIATE_COUNT],
-                                    metrics[SL_OT_COEX_EVENT_GRANT_IMMEDIATE_COUNT],
-                                    1);
+        SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_IMMEDIATE_COUNT], 1);
     }
     break;
 
     case SL_RAIL_UTIL_COEX_OT_EVENT_REQUESTED:
     {
-        sl_coex_counter.timestamp = otPlatAlarmMicroGetNow();
-        SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_REQUEST_COUNT],
-                                    metrics[SL_OT_COEX_EVENT_REQUEST_COUNT],
-                                    1);
+        sl_coex_counter.timestamp        = now;
+        sCoexRequestTimestamp[direction] = now;
+        SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_REQUEST_COUNT], 1);
     }
     break;
 
     case SL_RAIL_UTIL_COEX_OT_EVENT_GRANTED:
     {
-        uint32_t reqToGrantDuration = otPlatAlarmMicroGetNow() - sl_coex_counter.timestamp;
-        SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_ACTIVATED_COUNT],
-                                    metrics[SL_OT_COEX_EVENT_GRANT_WAIT_ACTIVATED_COUNT],
-                                    1);
+        reqToGrantDuration = now - sCoexRequestTimestamp[direction];
+        SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_ACTIVATED_COUNT], 1);
 
         if (reqToGrantDuration > 50)
         {
-            SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_DELAYED_GRANT_COUNT],
-                                        metrics[SL_OT_COEX_EVENT_DELAYED_GRANT_COUNT],
-                                        1);
+            SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_DELAYED_GRANT_COUNT], 1);
         }
 
         *totalReqToGrantDuration += reqToGrantDuration;
+        coexRecordLatency(direction, reqToGrantDuration);
     }
     break;
 
     case SL_RAIL_UTIL_COEX_OT_EVENT_DENIED:
     {
-        SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_TIMEOUT_COUNT],
-                                    metrics[SL_OT_COEX_EVENT_GRANT_WAIT_TIMEOUT_COUNT],
-                                    1);
+        SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_TIMEOUT_COUNT], 1);
     }
     break;
 
     case SL_RAIL_UTIL_COEX_OT_EVENT_GRANT_ABORTED:
     {
-        SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_GRANT_DEACTIVATED_DURING_REQUEST_COUNT],
-                                    metrics[SL_OT_COEX_EVENT_GRANT_DEACTIVATED_DURING_REQUEST_COUNT],
-                                    1);
+        SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_DEACTIVATED_DURING_REQUEST_COUNT], 1);
     }
     break;
 
@@ -152,14 +178,19 @@ void sl_rail_util_coex_ot_events(sl_rail_util_coex_ot_event_t event)
         break;
     }
 
-    SL_INCREMENT_IF_NO_OVERFLOW(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_COUNT],
-                                metrics[SL_OT_COEX_EVENT_GRANT_WAIT_TIMEOUT_COUNT],
-                                metrics[SL_OT_COEX_EVENT_GRANT_WAIT_ACTIVATED_COUNT]);
-    metrics[SL_OT_COEX_EVENT_AVG_REQUEST_TO_GRANT_TIME] =
-        *totalReqToGrantDuration / metrics[SL_OT_COEX_EVENT_REQUEST_COUNT];
+    metrics[SL_OT_COEX_EVENT_GRANT_WAIT_COUNT] = 0;
+    SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_COUNT],
+                            metrics[SL_OT_COEX_EVENT_GRANT_WAIT_TIMEOUT_COUNT]);
+    SL_INCREMENT_SATURATING(metrics[SL_OT_COEX_EVENT_GRANT_WAIT_COUNT],
+                            metrics[SL_OT_COEX_EVENT_GRANT_WAIT_ACTIVATED_COUNT]);
 
-exit:
-    return;
+    if (metrics[SL_OT_COEX_EVENT_REQUEST_COUNT] != 0)
+    {
+        metrics[SL_OT_COEX_EVENT_AVG_REQUEST_TO_GRANT_TIME] =
+            (uint32_t)(*totalReqToGrantDuration / metrics[SL_OT_COEX_EVENT_REQUEST_COUNT]);
+    }
+
+    coexRecordEvent((uint8_t)coexEvent, direction, now, reqToGrantDuration);
 }
 
 otError otPlatRadioGetCoexMetrics(otInstance *aInstance, otRadioCoexMetrics *aCoexMetrics)
@@ -176,9 +207,67 @@ exit:
     return error;
 }
 
+otError efr32RadioGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                           efr32CoexLatencyHistogram *aRxHistogram)
+{
+    otError error = OT_ERROR_NONE;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    otEXPECT_ACTION((aTxHistogram != NULL) && (aRxHistogram != NULL), error = OT_ERROR_INVALID_ARGS);
+
+    CORE_ENTER_ATOMIC();
+    *aTxHistogram = sCoexLatencyHistogram[COEX_DIRECTION_TX];
+    *aRxHistogram = sCoexLatencyHistogram[COEX_DIRECTION_RX];
+    CORE_EXIT_ATOMIC();
+
+exit:
+    return error;
+}
+
+otError efr32RadioGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t count;
+    uint8_t  numEntries;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    otEXPECT_ACTION((aEvents != NULL) && (aNumEntries != NULL), error = OT_ERROR_INVALID_ARGS);
+
+    CORE_ENTER_ATOMIC();
+    count      = sCoexEventCount;
+    numEntries = (count < SL_OPENTHREAD_COEX_EVENT_RING_SIZE) ? (uint8_t)count : SL_OPENTHREAD_COEX_EVENT_RING_SIZE;
+    numEntries = (numEntries < *aNumEntries) ? numEntries : *aNumEntries;
+
+    // Copy the most recent events, oldest first.
+    for (uint8_t i = 0; i < numEntries; i++)
+    {
+        aEvents[i] = sCoexEvents[(count - numEntries + i) % SL_OPENTHREAD_COEX_EVENT_RING_SIZE];
+    }
+    CORE_EXIT_ATOMIC();
+
+    *aNumEntries = numEntries;
+
+    if (aTotalEvents != NULL)
+    {
+        *aTotalEvents = count;
+    }
+
+exit:
+    return error;
+}
+
 void sli_radio_coex_reset(void)
 {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
     memset(&sl_coex_counter, 0, sizeof(sl_coex_counter));
+    memset(sCoexRequestTimestamp, 0, sizeof(sCoexRequestTimestamp));
+    memset(sCoexLatencyHistogram, 0, sizeof(sCoexLatencyHistogram));
+    sCoexEventCount = 0;
+    CORE_EXIT_ATOMIC();
 }
 
 #else
@@ -189,4 +278,20 @@ otError otPlatRadioGetCoexMetrics(otInstance *aInstance, otRadioCoexMetrics *aCo
     OT_UNUSED_VARIABLE(aCoexMetrics);
     return OT_ERROR_NOT_IMPLEMENTED;
 }
+
+otError efr32RadioGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                           efr32CoexLatencyHistogram *aRxHistogram)
+{
+    OT_UNUSED_VARIABLE(aTxHistogram);
+    OT_UNUSED_VARIABLE(aRxHistogram);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError efr32RadioGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents)
+{
+    OT_UNUSED_VARIABLE(aEvents);
+    OT_UNUSED_VARIABLE(aNumEntries);
+    OT_UNUSED_VARIABLE(aTotalEvents);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
 #endif // OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
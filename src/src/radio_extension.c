@@ -37,6 +37,7 @@
 #include <stdio.h>
 
 #include "radio_extension.h"
+#include "sl_radio_extension.h"
 
 #ifdef SL_COMPONENT_CATALOG_PRESENT
 #include "sl_component_catalog.h"
@@ -440,6 +441,21 @@ exit:
     return error;
 }
 
+extern otError efr32RadioGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                                  efr32CoexLatencyHistogram *aRxHistogram);
+extern otError efr32RadioGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents);
+
+otError otPlatRadioExtensionGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                                     efr32CoexLatencyHistogram *aRxHistogram)
+{
+    return efr32RadioGetCoexLatencyHistograms(aTxHistogram, aRxHistogram);
+}
+
+otError otPlatRadioExtensionGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents)
+{
+    return efr32RadioGetCoexEvents(aEvents, aNumEntries, aTotalEvents);
+}
+
 otError otPlatRadioExtensionSetRadioHoldoff(bool aEnabled)
 {
     otError error = OT_ERROR_NONE;
@@ -520,4 +536,177 @@ otError otPlatRadioExtensionClearRadioCounters(void)
     return error;
 }
 
+extern otError efr32RadioStartEnergySweep(uint32_t aChannelMask, uint16_t aDwellTimeMs);
+extern otError efr32RadioGetEnergySweepResults(efr32EnergySweepResult *aResults, uint8_t *aNumEntries);
+
+otError otPlatRadioExtensionStartEnergySweep(uint32_t aChannelMask, uint16_t aDwellTimeMs)
+{
+    return efr32RadioStartEnergySweep(aChannelMask, aDwellTimeMs);
+}
+
+otError otPlatRadioExtensionGetEnergySweepResults(efr32EnergySweepResult *aResults, uint8_t *aNumEntries)
+{
+    return efr32RadioGetEnergySweepResults(aResults, aNumEntries);
+}
+
+extern otError efr32RadioSetNoiseFloorMonitorInterval(uint32_t aIntervalUs);
+extern otError efr32RadioGetNoiseFloorStats(efr32NoiseFloorStats *aStats);
+extern otError efr32RadioClearNoiseFloorStats(void);
+
+otError otPlatRadioExtensionSetNoiseFloorMonitorInterval(uint32_t aIntervalUs)
+{
+    return efr32RadioSetNoiseFloorMonitorInterval(aIntervalUs);
+}
+
+otError otPlatRadioExtensionGetNoiseFloorStats(efr32NoiseFloorStats *aStats)
+{
+    return efr32RadioGetNoiseFloorStats(aStats);
+}
+
+otError otPlatRadioExtensionClearNoiseFloorStats(void)
+{
+    return efr32RadioClearNoiseFloorStats();
+}
+
+extern otError efr32RadioGetRadioTrace(efr32RadioTraceEntry *aEntries,
+                                       uint16_t             *aNumEntries,
+                                       uint32_t             *aTotalEntries);
+extern otError efr32RadioClearRadioTrace(void);
+
+otError otPlatRadioExtensionGetRadioTrace(efr32RadioTraceEntry *aEntries,
+                                          uint16_t             *aNumEntries,
+                                          uint32_t             *aTotalEntries)
+{
+    return efr32RadioGetRadioTrace(aEntries, aNumEntries, aTotalEntries);
+}
+
+otError otPlatRadioExtensionClearRadioTrace(void)
+{
+    return efr32RadioClearRadioTrace();
+}
+
+extern otError efr32RadioGetTxStats(uint8_t aIid, efr32TxStats *aStats);
+extern otError efr32RadioClearTxStats(void);
+
+otError otPlatRadioExtensionGetTxStats(uint8_t aIid, efr32TxStats *aStats)
+{
+    return efr32RadioGetTxStats(aIid, aStats);
+}
+
+otError otPlatRadioExtensionClearTxStats(void)
+{
+    return efr32RadioClearTxStats();
+}
+
+extern otError efr32RadioSetAdaptiveCcaEnabled(bool aEnabled);
+extern otError efr32RadioGetAdaptiveCcaCounters(efr32AdaptiveCcaCounters *aCounters);
+extern otError efr32RadioClearAdaptiveCcaCounters(void);
+
+otError otPlatRadioExtensionSetAdaptiveCcaEnabled(bool aEnabled)
+{
+    return efr32RadioSetAdaptiveCcaEnabled(aEnabled);
+}
+
+otError otPlatRadioExtensionGetAdaptiveCcaCounters(efr32AdaptiveCcaCounters *aCounters)
+{
+    return efr32RadioGetAdaptiveCcaCounters(aCounters);
+}
+
+otError otPlatRadioExtensionClearAdaptiveCcaCounters(void)
+{
+    return efr32RadioClearAdaptiveCcaCounters();
+}
+
+extern otError efr32RadioGetRadioCountersSnapshot(efr32RadioCountersSnapshot *aSnapshot);
+extern otError efr32RadioGetRadioCountersDelta(efr32RadioCountersSnapshot *aPrevious,
+                                               efr32RadioCountersSnapshot *aDelta);
+
+otError otPlatRadioExtensionGetRadioCountersSnapshot(efr32RadioCountersSnapshot *aSnapshot)
+{
+    return efr32RadioGetRadioCountersSnapshot(aSnapshot);
+}
+
+otError otPlatRadioExtensionGetRadioCountersDelta(efr32RadioCountersSnapshot *aPrevious,
+                                                  efr32RadioCountersSnapshot *aDelta)
+{
+    return efr32RadioGetRadioCountersDelta(aPrevious, aDelta);
+}
+
+extern otError efr32RadioGetRadioResidency(efr32RadioResidency *aResidency);
+extern otError efr32RadioGetRadioTimeStats(otRadioTimeStats *aStats);
+extern otError efr32RadioClearRadioResidency(void);
+
+otError otPlatRadioExtensionGetRadioResidency(efr32RadioResidency *aResidency)
+{
+    return efr32RadioGetRadioResidency(aResidency);
+}
+
+otError otPlatRadioExtensionGetRadioTimeStats(otRadioTimeStats *aStats)
+{
+    return efr32RadioGetRadioTimeStats(aStats);
+}
+
+otError otPlatRadioExtensionClearRadioResidency(void)
+{
+    return efr32RadioClearRadioResidency();
+}
+
+extern otError efr32RadioGetRadioReconfigCounters(efr32RadioReconfigCounters *aCounters);
+extern otError efr32RadioClearRadioReconfigCounters(void);
+
+otError otPlatRadioExtensionGetRadioReconfigCounters(efr32RadioReconfigCounters *aCounters)
+{
+    return efr32RadioGetRadioReconfigCounters(aCounters);
+}
+
+otError otPlatRadioExtensionClearRadioReconfigCounters(void)
+{
+    return efr32RadioClearRadioReconfigCounters();
+}
+
+extern otError efr32RadioGetCslDriftEstimate(efr32CslDriftEstimate *aEstimate);
+
+otError otPlatRadioExtensionGetCslDriftEstimate(efr32CslDriftEstimate *aEstimate)
+{
+    return efr32RadioGetCslDriftEstimate(aEstimate);
+}
+
+extern otError efr32RadioScheduleRxWindows(const efr32RxWindow *aWindows, uint8_t aCount);
+extern otError efr32RadioGetScheduledRxStats(efr32ScheduledRxStats *aStats);
+
+otError otPlatRadioExtensionScheduleRxWindows(const efr32RxWindow *aWindows, uint8_t aCount)
+{
+    return efr32RadioScheduleRxWindows(aWindows, aCount);
+}
+
+otError otPlatRadioExtensionGetScheduledRxStats(efr32ScheduledRxStats *aStats)
+{
+    return efr32RadioGetScheduledRxStats(aStats);
+}
+
+extern otError efr32RadioStartSnifferCapture(const uint8_t *aChannels, uint8_t aNumChannels);
+extern otError efr32RadioStopSnifferCapture(void);
+extern otError efr32RadioReadSnifferCapture(uint8_t *aBuffer, uint16_t aBufferLength, uint16_t *aBatchLength);
+extern otError efr32RadioGetSnifferCaptureCounters(efr32SnifferCaptureCounters *aCounters);
+
+otError otPlatRadioExtensionStartSnifferCapture(const uint8_t *aChannels, uint8_t aNumChannels)
+{
+    return efr32RadioStartSnifferCapture(aChannels, aNumChannels);
+}
+
+otError otPlatRadioExtensionStopSnifferCapture(void)
+{
+    return efr32RadioStopSnifferCapture();
+}
+
+otError otPlatRadioExtensionReadSnifferCapture(uint8_t *aBuffer, uint16_t aBufferLength, uint16_t *aBatchLength)
+{
+    return efr32RadioReadSnifferCapture(aBuffer, aBufferLength, aBatchLength);
+}
+
+otError otPlatRadioExtensionGetSnifferCaptureCounters(efr32SnifferCaptureCounters *aCounters)
+{
+    return efr32RadioGetSnifferCaptureCounters(aCounters);
+}
+
 #endif // SL_CATALOG_OPENTHREAD_EFR32_EXT_PRESENT
@@ -32,6 +32,8 @@
  *
  */
 
+#include <string.h>
+
 #include <openthread-core-config.h>
 
 #include "platform-band.h"
@@ -55,6 +57,10 @@
 static int8_t sli_max_channel_power[RADIO_INTERFACE_COUNT][SL_MAX_CHANNELS_SUPPORTED];
 static int8_t sli_default_tx_power[RADIO_INTERFACE_COUNT];
 
+// Tx power to use on each channel, derived from the two tables above whenever they change so that
+// the transmit path only needs a lookup.
+static int8_t sli_channel_tx_power[SL_MAX_CHANNELS_SUPPORTED];
+
 /**
  * This function gets the lowest value for the max_tx_power for a channel, from the max_tx_powerTable set
  * across all interfaces. It also gets the highest default_tx_power set across all interfaces.
@@ -92,6 +98,38 @@ static void sli_get_default_and_max_powers_across_iids(int8_t  *default_tx_power
     }
 }
 
+/**
+ * This function computes the tx power of a channel from the default and max tx power tables and stores it
+ * in sli_channel_tx_power.
+ *
+ * @param[in]   channel   Channel of interest
+ *
+ */
+static void sli_update_channel_tx_power(uint16_t channel)
+{
+    int8_t max_channel_tx_power = SL_INVALID_TX_POWER;
+    int8_t max_default_tx_power = SL_INVALID_TX_POWER;
+    int8_t selected_tx_power;
+
+    sli_get_default_and_max_powers_across_iids(&max_default_tx_power, &max_channel_tx_power, channel);
+
+    selected_tx_power = SL_MIN(max_channel_tx_power, max_default_tx_power);
+    sli_channel_tx_power[channel - SL_CHANNEL_MIN] =
+        (selected_tx_power == SL_INVALID_TX_POWER) ? OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER : selected_tx_power;
+}
+
+/**
+ * This function recomputes the tx power of all the channels.
+ *
+ */
+static void sli_update_tx_power_table(void)
+{
+    for (uint16_t channel = SL_CHANNEL_MIN; channel <= SL_CHANNEL_MAX; channel++)
+    {
+        sli_update_channel_tx_power(channel);
+    }
+}
+
 /**
  * This function returns the tx power to be used based on the default and max tx power table, for a given channel.
  *
@@ -102,12 +140,11 @@ static void sli_get_default_and_max_powers_across_iids(int8_t  *default_tx_power
  */
 static int8_t sli_get_max_tx_power_across_iids(uint16_t channel)
 {
+#if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     int8_t max_channel_tx_power = SL_INVALID_TX_POWER;
     int8_t max_default_tx_power = SL_INVALID_TX_POWER;
     int8_t selected_tx_power    = SL_INVALID_TX_POWER;
 
-#if FAST_CHANNEL_SWITCHING_SUPPORT && OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-
     if (sl_is_multi_channel_enabled())
     {
         sl_rail_ieee802154_rx_channel_switching_cfg_t channel_switching_cfg;
@@ -129,36 +166,76 @@ static int8_t sli_get_max_tx_power_across_iids(uint16_t channel)
             channel = channel_switching_cfg.channels[i];
             sli_get_default_and_max_powers_across_iids(&max_default_tx_power, &max_channel_tx_power, channel);
         }
+
+        // Return the minimum of max_channel_tx_power and max_default_tx_power.
+        selected_tx_power = SL_MIN(max_channel_tx_power, max_default_tx_power);
+        return (selected_tx_power == SL_INVALID_TX_POWER) ? OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
+                                                          : selected_tx_power;
     }
-    else
 #endif
-    {
-        sli_get_default_and_max_powers_across_iids(&max_default_tx_power, &max_channel_tx_power, channel);
-    }
 
-    // Return the minimum of max_channel_tx_power and max_default_tx_power.
-    selected_tx_power = SL_MIN(max_channel_tx_power, max_default_tx_power);
-    return (selected_tx_power == SL_INVALID_TX_POWER) ? OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER : selected_tx_power;
+    return sli_channel_tx_power[channel - SL_CHANNEL_MIN];
 }
 
+#else // OPENTHREAD_CONFIG_POWER_CALIBRATION_ENABLE
+
+// Power setting resolved from the raw calibration data of a channel.
+typedef struct
+{
+    uint8_t  raw_power_calibration[SL_OPENTHREAD_RAW_POWER_CALIBRATION_LENGTH];
+    uint16_t raw_calibration_length;
+    uint8_t  fem_setting[SL_OPENTHREAD_FEM_SETTING_LENGTH];
+    uint16_t fem_setting_length;
+    int8_t   tx_power;
+    bool     resolved;
+} sli_channel_power_setting_t;
+
+// The raw calibration data can be updated by the stack at any time, so it is still read for every frame,
+// but it is only parsed again, and the FEM only reconfigured, when it differs from the last one resolved.
+static sli_channel_power_setting_t  sli_channel_power_settings[SL_MAX_CHANNELS_SUPPORTED];
+static sli_channel_power_setting_t *sli_applied_fem_setting = NULL;
+
 #endif //! OPENTHREAD_CONFIG_POWER_CALIBRATION_ENABLE
 
+// Power last written to RAIL, SL_INVALID_TX_POWER when unknown. Frames sent back-to-back on the same channel
+// mostly use the same power, so the RAIL write, which resolves the PA level, is skipped when it did not change.
+static int8_t sli_applied_tx_power = SL_INVALID_TX_POWER;
+
 void sli_set_tx_power_in_rail(int8_t power_in_dbm)
 {
     sl_rail_status_t status;
 
+    otEXPECT_ACTION((power_in_dbm != sli_applied_tx_power) || (power_in_dbm == SL_INVALID_TX_POWER),
+                    gRadioReconfigCounters.mTxPowerWritesAvoided++);
+
     // sl_rail_set_tx_power_dbm() takes power in units of deci-dBm (0.1dBm)
     // Multiply by 10 because power_in_dbm is supposed be in units dBm
     status = sl_rail_set_tx_power_dbm(gRailHandle, ((sl_rail_tx_power_t)power_in_dbm) * 10);
 
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
+    sli_applied_tx_power = power_in_dbm;
+    gRadioReconfigCounters.mTxPowerWrites++;
+
+exit:
+    return;
+}
+
+void sli_invalidate_tx_power_in_rail(void)
+{
+    sli_applied_tx_power = SL_INVALID_TX_POWER;
 }
 
 void sli_init_power_manager(void)
 {
+    sli_invalidate_tx_power_in_rail();
+
 #if !OPENTHREAD_CONFIG_POWER_CALIBRATION_ENABLE
     memset(sli_max_channel_power, SL_INVALID_TX_POWER, sizeof(sli_max_channel_power));
     memset(sli_default_tx_power, SL_INVALID_TX_POWER, sizeof(sli_default_tx_power));
+    sli_update_tx_power_table();
+#else
+    memset(sli_channel_power_settings, 0, sizeof(sli_channel_power_settings));
+    sli_applied_fem_setting = NULL;
 #endif //! OPENTHREAD_CONFIG_POWER_CALIBRATION_ENABLE
 }
 
@@ -180,6 +257,7 @@ void sli_update_tx_power_after_config_update(const sl_rail_tx_power_config_t *tx
 
     status = sl_rail_config_tx_power(gRailHandle, tx_pwr_config);
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
+    sli_invalidate_tx_power_in_rail();
 
     status = sl_rail_set_tx_power_dbm(gRailHandle, tx_power_dbm);
     OT_ASSERT(status == SL_RAIL_STATUS_NO_ERROR);
@@ -196,7 +274,8 @@ otError sli_set_channel_max_tx_power(otInstance *instance, uint8_t channel, int8
     otEXPECT_ACTION(channel >= SL_CHANNEL_MIN && channel <= SL_CHANNEL_MAX, error = OT_ERROR_INVALID_ARGS);
 
     sli_max_channel_power[iid][channel - SL_CHANNEL_MIN] = max_power;
-    tx_power                                             = sl_get_tx_power_for_current_channel(instance);
+    sli_update_channel_tx_power(channel);
+    tx_power = sl_get_tx_power_for_current_channel(instance);
     sli_set_tx_power_in_rail(tx_power);
 
 exit:
@@ -218,7 +297,8 @@ otError sli_set_default_tx_power(otInstance *instance, int8_t tx_power)
     uint8_t iid = efr32GetIidFromInstance(instance);
 
     sli_default_tx_power[iid] = tx_power;
-    max_tx_power              = sl_get_tx_power_for_current_channel(instance);
+    sli_update_tx_power_table();
+    max_tx_power = sl_get_tx_power_for_current_channel(instance);
 
     sli_set_tx_power_in_rail(max_tx_power);
 #else
@@ -238,23 +318,38 @@ int8_t sl_get_tx_power_for_current_channel(otInstance *instance)
     sl_rail_get_channel(gRailHandle, &channel);
 
 #if OPENTHREAD_CONFIG_POWER_CALIBRATION_ENABLE
-    uint8_t  raw_power_calibration[SL_OPENTHREAD_RAW_POWER_CALIBRATION_LENGTH];
-    uint8_t  fem_setting[SL_OPENTHREAD_FEM_SETTING_LENGTH];
-    uint16_t raw_calibration_length = SL_OPENTHREAD_RAW_POWER_CALIBRATION_LENGTH;
-    uint16_t fem_setting_length     = SL_OPENTHREAD_FEM_SETTING_LENGTH;
-    otError  error;
+    sli_channel_power_setting_t *setting = &sli_channel_power_settings[channel - SL_CHANNEL_MIN];
+    uint8_t                      raw_power_calibration[SL_OPENTHREAD_RAW_POWER_CALIBRATION_LENGTH];
+    uint16_t                     raw_calibration_length = SL_OPENTHREAD_RAW_POWER_CALIBRATION_LENGTH;
+    otError                      error;
 
     error = otPlatRadioGetRawPowerSetting(instance, channel, raw_power_calibration, &raw_calibration_length);
 
-    error = sl_parse_raw_power_calibration_cb(raw_power_calibration,
-                                              raw_calibration_length,
-                                              &tx_power,
-                                              fem_setting,
-                                              &fem_setting_length);
-    OT_ASSERT(error == OT_ERROR_NONE);
+    if ((error != OT_ERROR_NONE) || !setting->resolved || (raw_calibration_length != setting->raw_calibration_length)
+        || (memcmp(raw_power_calibration, setting->raw_power_calibration, raw_calibration_length) != 0))
+    {
+        setting->fem_setting_length = SL_OPENTHREAD_FEM_SETTING_LENGTH;
+
+        error = sl_parse_raw_power_calibration_cb(raw_power_calibration,
+                                                  raw_calibration_length,
+                                                  &setting->tx_power,
+                                                  setting->fem_setting,
+                                                  &setting->fem_setting_length);
+        OT_ASSERT(error == OT_ERROR_NONE);
+
+        memcpy(setting->raw_power_calibration, raw_power_calibration, raw_calibration_length);
+        setting->raw_calibration_length = raw_calibration_length;
+        setting->resolved               = true;
+        sli_applied_fem_setting         = NULL;
+    }
 
-    sl_configure_fem_cb(fem_setting, fem_setting_length);
+    if (sli_applied_fem_setting != setting)
+    {
+        sl_configure_fem_cb(setting->fem_setting, setting->fem_setting_length);
+        sli_applied_fem_setting = setting;
+    }
 
+    tx_power = setting->tx_power;
 #else
     OT_UNUSED_VARIABLE(instance);
     tx_power = sli_get_max_tx_power_across_iids(channel);
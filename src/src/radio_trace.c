@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the storage and the reader of the radio event trace.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+
+#include "em_core.h"
+#include "radio_trace.h"
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE
+
+efr32RadioTrace gRadioTrace;
+
+void efr32RadioTraceRead(efr32RadioTraceEntry *aEntries, uint16_t *aNumEntries, uint32_t *aTotalEntries)
+{
+    uint32_t count;
+    uint16_t numEntries;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    count      = gRadioTrace.mCount;
+    numEntries = (count < SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE) ? (uint16_t)count
+                                                                 : SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE;
+    numEntries = (numEntries < *aNumEntries) ? numEntries : *aNumEntries;
+
+    for (uint16_t i = 0; i < numEntries; i++)
+    {
+        aEntries[i] = gRadioTrace.mEntries[(count - numEntries + i) & EFR32_RADIO_TRACE_MASK];
+    }
+    CORE_EXIT_ATOMIC();
+
+    *aNumEntries = numEntries;
+
+    if (aTotalEntries != NULL)
+    {
+        *aTotalEntries = count;
+    }
+}
+
+#endif // SL_OPENTHREAD_RADIO_TRACE_ENABLE
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   Binary trace of the radio events, for latency analysis.
+ *
+ *   When SL_OPENTHREAD_RADIO_TRACE_ENABLE is set, the RAIL event callback and the main loop radio processing
+ *   record their events in a ring of efr32RadioTraceEntry. Recording an entry only takes a short critical
+ *   section, so it is safe from interrupt context. Once full, the oldest entries are overwritten.
+ *
+ *   The entries are read with otPlatRadioExtensionGetRadioTrace(), or straight from the memory of a halted
+ *   device, and `script/analyze_radio_trace.py` rebuilds the per-frame timelines from them.
+ *
+ *   Entry layout (multi-byte fields are little endian):
+ *
+ *     | Offset | Size | Field                                                |
+ *     |--------|------|------------------------------------------------------|
+ *     | 0      | 4    | RAIL timestamp, in microseconds                      |
+ *     | 4      | 1    | Event (efr32RadioTraceEvent)                         |
+ *     | 5      | 1    | Interface index                                      |
+ *     | 6      | 2    | Event specific flags, see efr32RadioTraceEvent       |
+ */
+
+#ifndef RADIO_TRACE_H_
+#define RADIO_TRACE_H_
+
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+
+#include "em_core.h"
+#include "sl_radio_extension.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SL_OPENTHREAD_RADIO_TRACE_ENABLE
+
+#define EFR32_RADIO_TRACE_MASK (SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE - 1U)
+
+typedef struct efr32RadioTrace
+{
+    efr32RadioTraceEntry mEntries[SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE];
+    volatile uint32_t    mCount; // Number of entries recorded, the next one goes to mEntries[mCount & mask].
+} efr32RadioTrace;
+
+extern efr32RadioTrace gRadioTrace;
+
+/**
+ * Records a radio event.
+ *
+ * Safe to call from interrupt context.
+ *
+ * @param[in]  aTimestamp  The RAIL time of the event, in microseconds.
+ * @param[in]  aEvent      The event, one of efr32RadioTraceEvent.
+ * @param[in]  aIid        The interface index the event relates to, 0 if unknown.
+ * @param[in]  aFlags      The event specific flags.
+ */
+static inline void efr32RadioTraceRecord(uint32_t aTimestamp, uint8_t aEvent, uint8_t aIid, uint16_t aFlags)
+{
+    efr32RadioTraceEntry *entry;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    entry             = &gRadioTrace.mEntries[gRadioTrace.mCount & EFR32_RADIO_TRACE_MASK];
+    entry->mTimestamp = aTimestamp;
+    entry->mEvent     = aEvent;
+    entry->mIid       = aIid;
+    entry->mFlags     = aFlags;
+    gRadioTrace.mCount++;
+    CORE_EXIT_ATOMIC();
+}
+
+/**
+ * Copies the most recent entries of the trace, oldest first.
+ *
+ * @param[out]     aEntries       An array receiving the entries.
+ * @param[in,out]  aNumEntries    On input, the number of entries in @p aEntries. On output, the number of
+ *                                entries written.
+ * @param[out]     aTotalEntries  Optional, receives the number of entries recorded since the last clear.
+ */
+void efr32RadioTraceRead(efr32RadioTraceEntry *aEntries, uint16_t *aNumEntries, uint32_t *aTotalEntries);
+
+/**
+ * Discards all the entries of the trace.
+ */
+static inline void efr32RadioTraceClear(void)
+{
+    gRadioTrace.mCount = 0;
+}
+
+#define EFR32_RADIO_TRACE(aTimestamp, aEvent, aIid, aFlags) \
+    efr32RadioTraceRecord((aTimestamp), (aEvent), (aIid), (uint16_t)(aFlags))
+
+#else // SL_OPENTHREAD_RADIO_TRACE_ENABLE
+
+#define EFR32_RADIO_TRACE(aTimestamp, aEvent, aIid, aFlags)
+
+#endif // SL_OPENTHREAD_RADIO_TRACE_ENABLE
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // RADIO_TRACE_H_
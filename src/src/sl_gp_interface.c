@@ -33,18 +33,25 @@
 
 #include "sl_gp_interface.h"
 #include "ieee802154mac.h"
+#include "platform-efr32.h"
+#include "sl_common.h"
 #include "sl_gp_interface_config.h"
+#include "sl_multipan.h"
 #include "sl_packet_utils.h"
 #include "sl_rail_ieee802154.h"
+#include "sl_sleeptimer.h"
 #include "sl_status.h"
 #include <assert.h>
 #include <string.h>
+#include <openthread-core-config.h>
+#include <openthread-system.h>
 #include <openthread/platform/diag.h>
 #include <openthread/platform/time.h>
 #include "common/debug.hpp"
 #include "common/logging.hpp"
 #include "utils/code_utils.h"
-#include "utils/mac_frame.h"
+
+#include "logging_plat.h"
 
 // This implements mechanism to buffer outgoing Channel Configuration (0xF3) and
 // Commissioning Reply (0xF0) GPDF commands on the RCP to sent out on request
@@ -56,6 +63,16 @@
 // The GPD sends request indicating its RX capability, this again intercept the
 // rx message and based on the request, it sends out the above buffered message
 // with in a time window of 20-25 msec from the time it received the message.
+// One frame is buffered per GPD, keyed by its SrcID or EUI64 and endpoint, so
+// that the hosts can commission several GPDs at once. The transmission of the
+// host is done once its frame is buffered, so that it can hand over the frame
+// of the next GPD right away. The outcome of the response is reported to the
+// host with sl_gp_intf_response_done_cb() later on. The response is sent at
+// the start of its window from a buffer of the radio driver, which keeps the
+// radio free until shortly before. The buffering timeouts are handled by a
+// timer rather than polled. Each slot of the table counts the responses sent
+// in their window (hits), the responses requested but not sent in their window
+// (misses) and the frames never requested by their GPD (timeouts).
 
 #define GP_MIN_MAINTENANCE_FRAME_LENGTH 10
 #define GP_MIN_DATA_FRAME_LENGTH 14
@@ -84,93 +101,354 @@
 #define GP_COMMAND_INDEX_WITH_APP_MODE_1 3
 #define GP_COMMAND_INDEX_WITH_APP_MODE_0 6
 
-#define BUFFERED_PSDU_GP_SRC_ID_INDEX_WITH_APP_MODE_0 9
-#define BUFFERED_PSDU_GP_APP_EP_INDEX_WITH_APP_MODE_1 15
+// Checks if a parsed MAC frame carries a GP NWK frame.
+static bool gpIsGpFrame(const otRadioFrame *aFrame, const efr32MacFrameInfo *aInfo)
+{
+    /* clang-format off */
+
+    // A Typical MAC Frame with GP NWK Frame in it
+    // MAC Frame  : [<---------------MAC Header------------->||<------------------------------------NWK Frame----------------------------------->]
+    //               FC(2) | Seq(1) | DstPan(2) | DstAddr(2) || FC(1) | ExtFC(0/1) | SrcId(0/4) | SecFc(0/4) | MIC(0/4) | <------GPDF(1/n)------>
+
+    /* clang-format on */
+
+    bool    isGpPkt = false;
+    uint8_t fc      = aFrame->mPsdu[aInfo->mPayloadOffset];
+
+    // Criteria:
+    //  - The basic Identification of a GPDF Frame : The minimum GPDF length need to be 10 in this case for any
+    //  direction
+    //  - Network layer FC containing the Protocol Version field as 3.
+    //  - The frame version should be 2003.
+
+    bool lengthCheck         = (aFrame->mLength >= GP_MIN_MAINTENANCE_FRAME_LENGTH);
+    bool networkVersionCheck = GP_NWK_PROTOCOL_VERSION_CHECK(fc);
+    bool frameVersionCheck   = ((aInfo->mFcf & IEEE802154_FRAME_VERSION_MASK) == IEEE802154_FRAME_VERSION_2003);
+
+    isGpPkt = (lengthCheck && networkVersionCheck && frameVersionCheck);
+#if 0 // Debugging
+    if (!isGpPkt)
+    {
+        otLogCritPlat("GP RCP INTF checks: Length = %d, NWK Version = %d, PanId Compression = %d, Frame Version = %d",
+                    lengthCheck,
+                    networkVersionCheck,
+                    panIdCompressionCheck,
+                    frameVersionCheck);
+    }
+#endif
+    return isGpPkt;
+}
 
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
-static volatile sl_gp_state_t gp_state = SL_GP_STATE_INIT;
-static volatile uint64_t      gpStateTimeOut;
+// The response must go out between 20 and 25 msec after the request, GP_RX_OFFSET_IN_MICRO_SECONDS opens the window.
+#define GP_RX_WINDOW_IN_MICRO_SECONDS 5000
 
-// Needed to retrieve buffered transmit frame present in global memory.
-static otInstance *sBufferedTxInstance = NULL;
+// The GPD Channel Request does not identify the GPD, the Channel Configuration is buffered under this key.
+#define GP_KEY_APP_ID_MAINTENANCE 0xFF
 
-sl_gp_state_t sl_gp_intf_get_state(void)
+#define GP_TX_TABLE_SIZE SL_OPENTHREAD_GP_TX_TABLE_SIZE
+#define GP_TX_SLOT_INVALID 0xFF
+
+// Identifies the GPD a frame is sent to or received from.
+typedef struct
+{
+    uint8_t mAppId;                    // GP_ADDRESSING_MODE_SRC_ID, GP_ADDRESSING_MODE_EUI64 or maintenance.
+    uint8_t mEndpoint;                 // Application endpoint, with GP_ADDRESSING_MODE_EUI64.
+    uint8_t mId[sizeof(otExtAddress)]; // GPD SrcID in the first 4 bytes, or GPD IEEE address.
+} gpKey;
+
+// A frame buffered by a host until its GPD requests it.
+typedef struct
+{
+    gpKey         mKey;
+    otInstance   *mInstance; // Instance of the host which buffered the frame.
+    uint64_t      mTimeout;  // End of the buffering, or time of the response once requested.
+    sl_gp_state_t mState;    // SL_GP_STATE_WAITING_FOR_PKT or SL_GP_STATE_SEND_RESPONSE while in use.
+    uint8_t       mChannel;
+    uint8_t       mLength;
+    uint8_t       mPsdu[IEEE802154_MAX_LENGTH];
+} gpTxSlot;
+
+static gpTxSlot                     sGpTxTable[GP_TX_TABLE_SIZE];
+static sl_gp_tx_slot_counters_t     sGpTxCounters[GP_TX_TABLE_SIZE];
+static sl_gp_tx_stats_t             sGpTxStats;
+static uint8_t                      sGpTxSlotCount;                        // Number of slots in use.
+static uint8_t                      sGpTxDeferredCount;                    // Responses waiting for the radio.
+static uint8_t                      sGpTxSendingSlot = GP_TX_SLOT_INVALID; // Slot of the response on air.
+static otInstance                  *sGpTxSendingInstance;                  // Host of the response on air.
+static uint32_t                     sGpTxDonePendingMask;                  // Hosts to report done to, by IID.
+static sl_sleeptimer_timer_handle_t sGpTxTimer;                            // Expires with the earliest buffered frame.
+static volatile bool                sGpTxTimerFired;
+
+static inline bool gpTxSlotInUse(const gpTxSlot *aSlot)
 {
-    return gp_state;
+    return (aSlot->mState == SL_GP_STATE_WAITING_FOR_PKT) || (aSlot->mState == SL_GP_STATE_SEND_RESPONSE);
 }
 
-void efr32GpProcess(void)
+// Lookups start at the slot the key hashes to, so with the GPDs spread over the table a request is matched
+// without walking the other slots.
+static uint8_t gpKeyHash(const gpKey *aKey)
 {
-    switch (gp_state)
+    uint8_t hash = aKey->mAppId ^ aKey->mEndpoint;
+
+    for (uint8_t i = 0; i < sizeof(aKey->mId); i++)
     {
-    case SL_GP_STATE_INIT:
+        hash = (uint8_t)((hash << 1) | (hash >> 7)) ^ aKey->mId[i];
+    }
+
+    return hash % GP_TX_TABLE_SIZE;
+}
+
+static uint8_t gpTxTableFind(const gpKey *aKey)
+{
+    uint8_t index = gpKeyHash(aKey);
+
+    for (uint8_t i = 0; i < GP_TX_TABLE_SIZE; i++)
     {
-        gp_state = SL_GP_STATE_IDLE;
-        otLogDebgPlat("GP RCP INTF: GP Frame init!!");
+        otEXPECT(!gpTxSlotInUse(&sGpTxTable[index]) || memcmp(&sGpTxTable[index].mKey, aKey, sizeof(gpKey)));
+        index = (index + 1) % GP_TX_TABLE_SIZE;
     }
-    break;
-    case SL_GP_STATE_SEND_RESPONSE:
+
+    index = GP_TX_SLOT_INVALID;
+
+exit:
+    return index;
+}
+
+static uint8_t gpTxTableFindFree(const gpKey *aKey)
+{
+    uint8_t index = gpKeyHash(aKey);
+
+    for (uint8_t i = 0; i < GP_TX_TABLE_SIZE; i++)
     {
-        if (otPlatTimeGet() >= gpStateTimeOut)
+        otEXPECT(gpTxSlotInUse(&sGpTxTable[index]));
+        index = (index + 1) % GP_TX_TABLE_SIZE;
+    }
+
+    index = GP_TX_SLOT_INVALID;
+
+exit:
+    return index;
+}
+
+static void gpTxTimerCallback(sl_sleeptimer_timer_handle_t *aHandle, void *aData)
+{
+    OT_UNUSED_VARIABLE(aHandle);
+    OT_UNUSED_VARIABLE(aData);
+
+    sGpTxTimerFired = true;
+    otSysEventSignalPending();
+}
+
+// Arms the timer for the earliest buffered frame to time out, the table is only walked when it expires.
+static void gpTxTimerUpdate(void)
+{
+    uint64_t earliest = UINT64_MAX;
+    uint64_t now;
+
+    (void)sl_sleeptimer_stop_timer(&sGpTxTimer);
+
+    for (uint8_t i = 0; i < GP_TX_TABLE_SIZE; i++)
+    {
+        if ((sGpTxTable[i].mState == SL_GP_STATE_WAITING_FOR_PKT) && (sGpTxTable[i].mTimeout < earliest))
         {
-            OT_ASSERT(sBufferedTxInstance != NULL);
-            // Get the tx frame and send it without csma.
-            otRadioFrame *aTxFrame                   = otPlatRadioGetTransmitBuffer(sBufferedTxInstance);
-            aTxFrame->mInfo.mTxInfo.mCsmaCaEnabled   = false;
-            aTxFrame->mInfo.mTxInfo.mMaxCsmaBackoffs = 0;
-            // On successful transmit, this will call the transmit complete callback for the GP packet,
-            // and go up to the CGP Send Handler and eventually the green power client.
-            otPlatRadioTransmit(sBufferedTxInstance, aTxFrame);
-
-            gp_state            = SL_GP_STATE_IDLE;
-            sBufferedTxInstance = NULL;
-            otLogDebgPlat("GP RCP INTF: Sending Response!!");
+            earliest = sGpTxTable[i].mTimeout;
         }
     }
-    break;
-    case SL_GP_STATE_WAITING_FOR_PKT:
+
+    otEXPECT(earliest != UINT64_MAX);
+
+    now = otPlatTimeGet();
+    (void)sl_sleeptimer_start_timer_ms(&sGpTxTimer,
+                                       (earliest > now) ? (uint32_t)((earliest - now + 999) / 1000) : 0,
+                                       gpTxTimerCallback,
+                                       NULL,
+                                       0,
+                                       0);
+
+exit:
+    return;
+}
+
+// Completing the transmission from within otPlatRadioTransmit() is not allowed, it is done by efr32GpProcess().
+static void gpTxReportDone(otInstance *aInstance)
+{
+    uint8_t iid = efr32GetIidFromInstance(aInstance);
+
+    OT_ASSERT(iid < RADIO_INTERFACE_COUNT);
+
+    sGpTxDonePendingMask |= (1UL << iid);
+    otSysEventSignalPending();
+}
+
+SL_WEAK void sl_gp_intf_response_done_cb(otInstance *aInstance, otError aError)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aError);
+}
+
+static void gpTxSlotFree(uint8_t aIndex)
+{
+    OT_ASSERT(sGpTxSlotCount > 0);
+
+    if (sGpTxTable[aIndex].mState == SL_GP_STATE_SEND_RESPONSE)
+    {
+        sGpTxDeferredCount--;
+    }
+
+    sGpTxTable[aIndex].mState = SL_GP_STATE_IDLE;
+    sGpTxSlotCount--;
+}
+
+// Hands the response over to the radio, which starts it at the start of the response window. Only if the radio
+// still holds the response to another GPD, the response is retried once that one is done, see gpTxSendDeferred().
+static void gpTxSlotSendResponse(uint8_t aIndex)
+{
+    gpTxSlot *slot  = &sGpTxTable[aIndex];
+    otError   error = OT_ERROR_FAILED;
+    uint64_t  now   = otPlatTimeGet();
+
+    if (now < slot->mTimeout + GP_RX_WINDOW_IN_MICRO_SECONDS)
+    {
+        // The bottom 32 bits of the platform time are the RAIL time.
+        error = efr32RadioTransmitGpFrame(slot->mInstance,
+                                          slot->mPsdu,
+                                          slot->mLength,
+                                          slot->mChannel,
+                                          (uint32_t)slot->mTimeout,
+                                          GP_RX_WINDOW_IN_MICRO_SECONDS);
+    }
+
+    if (error == OT_ERROR_NONE)
     {
-        if (otPlatTimeGet() >= gpStateTimeOut)
+        if (now < slot->mTimeout)
+        {
+            sGpTxStats.mScheduled++;
+        }
+        else
         {
-            OT_ASSERT(sBufferedTxInstance != NULL);
-            // This is a timeout call for the case when the GPD did not poll the response with in 5 seconds.
-            otPlatRadioTxDone(sBufferedTxInstance,
-                              otPlatRadioGetTransmitBuffer(sBufferedTxInstance),
-                              NULL,
-                              OT_ERROR_ABORT);
-            gp_state            = SL_GP_STATE_IDLE;
-            sBufferedTxInstance = NULL;
+            sGpTxStats.mDeferred++;
         }
+
+        sGpTxSendingSlot     = aIndex;
+        sGpTxSendingInstance = slot->mInstance;
+        gpTxSlotFree(aIndex);
+        otLogDebgPlat("GP RCP INTF: Sending Response!!");
     }
-    break;
-    default:
+    else if (error != OT_ERROR_BUSY)
     {
-        // For all other states don't do anything
+        sGpTxCounters[aIndex].mMisses++;
+        sl_gp_intf_response_done_cb(slot->mInstance, OT_ERROR_ABORT);
+        gpTxSlotFree(aIndex);
+        otLogDebgPlat("GP RCP INTF: Response window missed!!");
     }
-    break;
+    else if (slot->mState != SL_GP_STATE_SEND_RESPONSE)
+    {
+        slot->mState = SL_GP_STATE_SEND_RESPONSE;
+        sGpTxDeferredCount++;
     }
 }
 
-void sl_gp_intf_buffer_pkt(otInstance *aInstance)
+// The radio only holds one response, the responses requested meanwhile are handed over when it is done with it.
+static void gpTxSendDeferred(void)
 {
-    gpStateTimeOut = otPlatTimeGet() + GP_TX_MAX_TIMEOUT_IN_MICRO_SECONDS;
-    gp_state       = SL_GP_STATE_WAITING_FOR_PKT;
-    OT_ASSERT(aInstance != NULL);
-    sBufferedTxInstance = aInstance;
-    otLogDebgPlat("GP RCP INTF: buffered!!");
+    for (uint8_t i = 0; (sGpTxDeferredCount > 0) && (i < GP_TX_TABLE_SIZE); i++)
+    {
+        if (sGpTxTable[i].mState == SL_GP_STATE_SEND_RESPONSE)
+        {
+            gpTxSlotSendResponse(i);
+        }
+    }
 }
 
-bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, bool isRxFrame)
+static void gpTxTableOnRequest(const gpKey *aKey, const otRadioFrame *aFrame)
+{
+    uint8_t index = gpTxTableFind(aKey);
+
+    otEXPECT_ACTION(index != GP_TX_SLOT_INVALID, sGpTxStats.mUnmatchedRequests++);
+    otEXPECT(sGpTxTable[index].mState == SL_GP_STATE_WAITING_FOR_PKT);
+
+    sGpTxStats.mRequests++;
+
+    // Send out the buffered frame
+    sGpTxTable[index].mTimeout = aFrame->mInfo.mRxInfo.mTimestamp + GP_RX_OFFSET_IN_MICRO_SECONDS;
+    gpTxSlotSendResponse(index);
+    gpTxTimerUpdate();
+
+exit:
+    return;
+}
+
+sl_gp_state_t sl_gp_intf_get_state(void)
 {
-    bool shouldBufferPacket = false;
+    sl_gp_state_t state = (sGpTxSlotCount > 0) ? SL_GP_STATE_WAITING_FOR_PKT : SL_GP_STATE_IDLE;
+
+    for (uint8_t i = 0; (state != SL_GP_STATE_IDLE) && (i < GP_TX_TABLE_SIZE); i++)
+    {
+        if (sGpTxTable[i].mState == SL_GP_STATE_SEND_RESPONSE)
+        {
+            state = SL_GP_STATE_SEND_RESPONSE;
+            break;
+        }
+    }
+
+    return state;
+}
+
+void efr32GpProcess(void)
+{
+    uint64_t now;
+
+    for (uint8_t iid = 0; sGpTxDonePendingMask != 0; iid++)
+    {
+        if (sGpTxDonePendingMask & (1UL << iid))
+        {
+            otInstance *instance = otPlatMultipanIidToInstance(iid);
+
+            sGpTxDonePendingMask &= ~(1UL << iid);
+            otPlatRadioTxDone(instance, otPlatRadioGetTransmitBuffer(instance), NULL, OT_ERROR_NONE);
+        }
+    }
+
+    otEXPECT(sGpTxTimerFired);
+    sGpTxTimerFired = false;
+
+    now = otPlatTimeGet();
+
+    for (uint8_t i = 0; i < GP_TX_TABLE_SIZE; i++)
+    {
+        if (sGpTxTable[i].mState == SL_GP_STATE_WAITING_FOR_PKT && now >= sGpTxTable[i].mTimeout)
+        {
+            // This is a timeout for the case when the GPD did not poll the response with in 5 seconds.
+            sGpTxCounters[i].mTimeouts++;
+            sl_gp_intf_response_done_cb(sGpTxTable[i].mInstance, OT_ERROR_ABORT);
+            gpTxSlotFree(i);
+            otLogDebgPlat("GP RCP INTF: Buffered frame timed out!!");
+        }
+    }
+
+    gpTxTimerUpdate();
+
+exit:
+    return;
+}
+
+// Checks if a GP frame is a response to buffer (Tx) or a request for a buffered response (Rx), and reads
+// the key of the GPD it is sent to or received from.
+static bool gpParseFrame(otRadioFrame *aFrame, bool isRxFrame, gpKey *aKey)
+{
+    bool matched = false;
 
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     // Exit immediately if diag mode is enabled.
-    otEXPECT_ACTION(!otPlatDiagModeGet(), shouldBufferPacket = false);
+    otEXPECT_ACTION(!otPlatDiagModeGet(), matched = false);
 #endif
 
-    uint8_t *gpFrameStartIndex = efr32GetPayload(aFrame);
-    otEXPECT_ACTION(gpFrameStartIndex != NULL, shouldBufferPacket = false);
+    // The MAC header is parsed once, the GP checks below use its layout.
+    efr32MacFrameInfo frameInfo;
+    otEXPECT_ACTION(efr32ParseMacFrame(aFrame, &frameInfo), matched = false);
+
+    uint8_t *gpFrameStartIndex = efr32MacFrameGetPayload(aFrame, &frameInfo);
 
     // A Typical MAC Frame with GP NWK Frame in it
     /* clang-format off */
@@ -191,7 +469,9 @@ bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, b
                   fc);
 
     // Check if packet is a GP packet
-    otEXPECT_ACTION(sl_gp_intf_is_gp_pkt(aFrame), shouldBufferPacket = false);
+    otEXPECT_ACTION(gpIsGpFrame(aFrame, &frameInfo), matched = false);
+
+    memset(aKey, 0, sizeof(gpKey));
 
     otLogDebgPlat("GP RCP INTF : (%s) Length and Version Matched", isRxFrame ? "Rx" : "Tx");
     // For GP Maintenance Frame type without extended FC, the FC is exactly same for both RX and TX directions with
@@ -201,18 +481,17 @@ bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, b
     {
         otLogDebgPlat("GP RCP INTF : (%s) Maintenance Frame match", isRxFrame ? "Rx" : "Tx");
         uint8_t cmdId = *(gpFrameStartIndex + GP_COMMAND_INDEX_FOR_MAINT_FRAME);
-        if (cmdId == GP_CHANNEL_REQUEST_CMD_ID && isRxFrame && gp_state == SL_GP_STATE_WAITING_FOR_PKT)
+        aKey->mAppId  = GP_KEY_APP_ID_MAINTENANCE;
+        if (cmdId == GP_CHANNEL_REQUEST_CMD_ID && isRxFrame)
         {
-            // Send out the buffered frame
-            gp_state       = SL_GP_STATE_SEND_RESPONSE;
-            gpStateTimeOut = aFrame->mInfo.mRxInfo.mTimestamp + GP_RX_OFFSET_IN_MICRO_SECONDS;
+            matched = true;
             otLogDebgPlat("GP RCP INTF : (%s) Received GP_CHANNEL_REQUEST_CMD_ID - Send the Channel configuration",
                           isRxFrame ? "Rx" : "Tx");
         }
         else if (cmdId == GP_CHANNEL_CONFIGURATION_CMD_ID && !isRxFrame)
         {
             // Buffer the frame
-            shouldBufferPacket = true;
+            matched = true;
             otLogDebgPlat("GP RCP INTF : (%s) Buffer GP_CHANNEL_CONFIGURATION_CMD_ID command", isRxFrame ? "Rx" : "Tx");
         }
     }
@@ -235,105 +514,194 @@ bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, b
             if (GP_NWK_ADDRESSING_APP_ID(extFc) == GP_ADDRESSING_MODE_SRC_ID)
             {
                 uint8_t cmdId = *(gpFrameStartIndex + GP_COMMAND_INDEX_WITH_APP_MODE_0);
+
+                // The gpd src Id is carried in both directions.
+                aKey->mAppId = GP_ADDRESSING_MODE_SRC_ID;
+                memcpy(aKey->mId, gpFrameStartIndex + GP_SRC_ID_INDEX_WITH_APP_MODE_0, sizeof(uint32_t));
+
                 if (cmdId == GP_COMMISSIONING_REPLY_CMD_ID && !isRxFrame)
                 {
                     // Buffer the frame
-                    shouldBufferPacket = true;
+                    matched = true;
                 }
                 else if ((cmdId == GP_COMMISSIONINGING_CMD_ID || (0xE4 <= cmdId && cmdId <= 0xEF)
                           || (0xB0 <= cmdId && cmdId <= 0xBF))
-                         && isRxFrame && gp_state == SL_GP_STATE_WAITING_FOR_PKT)
+                         && isRxFrame)
                 {
-                    otRadioFrame *aTxFrame = otPlatRadioGetTransmitBuffer(aInstance);
-                    // Match the gpd src Id ?
-                    if (!memcmp((const void *)(gpFrameStartIndex + GP_SRC_ID_INDEX_WITH_APP_MODE_0),
-                                (const void *)((aTxFrame->mPsdu) + BUFFERED_PSDU_GP_SRC_ID_INDEX_WITH_APP_MODE_0),
-                                sizeof(uint32_t)))
-                    {
-                        // Send out the buffered frame
-                        gp_state       = SL_GP_STATE_SEND_RESPONSE;
-                        gpStateTimeOut = aFrame->mInfo.mRxInfo.mTimestamp + GP_RX_OFFSET_IN_MICRO_SECONDS;
-                    }
+                    matched = true;
                 }
             }
             else if (GP_NWK_ADDRESSING_APP_ID(extFc) == GP_ADDRESSING_MODE_EUI64)
             {
-                uint8_t cmdId = *(gpFrameStartIndex + GP_COMMAND_INDEX_WITH_APP_MODE_1);
+                uint8_t cmdId      = *(gpFrameStartIndex + GP_COMMAND_INDEX_WITH_APP_MODE_1);
+                uint8_t addrOffset = isRxFrame ? frameInfo.mSrcAddrOffset : frameInfo.mDstAddrOffset;
+                uint8_t addrLength = isRxFrame ? frameInfo.mSrcAddrLength : frameInfo.mDstAddrLength;
+
+                // The eui64 of the GPD is the destination of the response and the source of the request, the app
+                // endpoint is carried in both directions.
+                otEXPECT_ACTION(addrLength == sizeof(otExtAddress), matched = false);
+
+                aKey->mAppId    = GP_ADDRESSING_MODE_EUI64;
+                aKey->mEndpoint = gpFrameStartIndex[GP_APP_EP_INDEX_WITH_APP_MODE_1];
+                memcpy(aKey->mId, aFrame->mPsdu + addrOffset, sizeof(otExtAddress));
+
                 if (cmdId == GP_COMMISSIONING_REPLY_CMD_ID && !isRxFrame)
                 {
                     // Buffer the frame
-                    shouldBufferPacket = true;
+                    matched = true;
                 }
                 else if ((cmdId == GP_COMMISSIONINGING_CMD_ID || (0xE4 <= cmdId && cmdId <= 0xEF)
                           || (0xB0 <= cmdId && cmdId <= 0xBF))
-                         && isRxFrame && gp_state == SL_GP_STATE_WAITING_FOR_PKT)
+                         && isRxFrame)
                 {
-                    otRadioFrame *aTxFrame = otPlatRadioGetTransmitBuffer(aInstance);
-                    // Check the eui64 and app endpoint to send out the buffer packet.
-                    otMacAddress aSrcAddress;
-                    otMacAddress aDstAddress;
-                    otMacFrameGetDstAddr(aTxFrame, &aDstAddress);
-                    otMacFrameGetSrcAddr(aFrame, &aSrcAddress);
-                    if (!memcmp(&(aDstAddress.mAddress.mExtAddress),
-                                &(aSrcAddress.mAddress.mExtAddress),
-                                sizeof(otExtAddress))
-                        && (gpFrameStartIndex[GP_APP_EP_INDEX_WITH_APP_MODE_1]
-                            == (aTxFrame->mPsdu)[BUFFERED_PSDU_GP_APP_EP_INDEX_WITH_APP_MODE_1]))
-                    {
-                        gp_state       = SL_GP_STATE_SEND_RESPONSE;
-                        gpStateTimeOut = aFrame->mInfo.mRxInfo.mTimestamp + GP_RX_OFFSET_IN_MICRO_SECONDS;
-                    }
+                    matched = true;
                 }
             }
         }
     }
 
-    if (shouldBufferPacket)
+exit:
+    return matched;
+}
+
+otError sl_gp_intf_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    otError error = OT_ERROR_NONE;
+    gpKey   key;
+    uint8_t index;
+
+    OT_ASSERT(aInstance != NULL);
+    otEXPECT_ACTION(gpParseFrame(aFrame, false, &key), error = OT_ERROR_INVALID_ARGS);
+
+    // A newer frame for the same GPD replaces the buffered one.
+    index = gpTxTableFind(&key);
+
+    if (index == GP_TX_SLOT_INVALID)
+    {
+        index = gpTxTableFindFree(&key);
+        otEXPECT_ACTION(index != GP_TX_SLOT_INVALID, error = OT_ERROR_NO_BUFS);
+        sGpTxSlotCount++;
+    }
+    else
+    {
+        if (sGpTxTable[index].mState == SL_GP_STATE_SEND_RESPONSE)
+        {
+            sGpTxDeferredCount--;
+        }
+
+        // The response of another host is not sent once its frame is replaced.
+        if (sGpTxTable[index].mInstance != aInstance)
+        {
+            sl_gp_intf_response_done_cb(sGpTxTable[index].mInstance, OT_ERROR_ABORT);
+        }
+    }
+
+    sGpTxTable[index].mKey      = key;
+    sGpTxTable[index].mInstance = aInstance;
+    sGpTxTable[index].mTimeout  = otPlatTimeGet() + GP_TX_MAX_TIMEOUT_IN_MICRO_SECONDS;
+    sGpTxTable[index].mState    = SL_GP_STATE_WAITING_FOR_PKT;
+    sGpTxTable[index].mChannel  = aFrame->mChannel;
+    sGpTxTable[index].mLength   = (uint8_t)aFrame->mLength;
+    memcpy(sGpTxTable[index].mPsdu, aFrame->mPsdu, aFrame->mLength);
+    gpTxTimerUpdate();
+    gpTxReportDone(aInstance);
+    otLogDebgPlat("GP RCP INTF: buffered!!");
+
+exit:
+    return error;
+}
+
+bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, bool isRxFrame)
+{
+    bool  shouldBufferPacket = false;
+    gpKey key;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otEXPECT(gpParseFrame(aFrame, isRxFrame, &key));
+
+    if (isRxFrame)
+    {
+        gpTxTableOnRequest(&key, aFrame);
+    }
+    else
     {
+        shouldBufferPacket = true;
         otLogDebgPlat("GP RCP INTF: GP filter passed!!");
     }
 
 exit:
     return shouldBufferPacket;
 }
-#endif // OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
 
-bool sl_gp_intf_is_gp_pkt(otRadioFrame *aFrame)
+void sl_gp_intf_process_rx_pkt(otRadioFrame *aFrame)
 {
-    /* clang-format off */
+    // The frame is only parsed while a response is buffered.
+    otEXPECT(sGpTxSlotCount > 0);
+    (void)sl_gp_intf_should_buffer_pkt(NULL, aFrame, true);
 
-    // A Typical MAC Frame with GP NWK Frame in it
-    // MAC Frame  : [<---------------MAC Header------------->||<------------------------------------NWK Frame----------------------------------->]
-    //               FC(2) | Seq(1) | DstPan(2) | DstAddr(2) || FC(1) | ExtFC(0/1) | SrcId(0/4) | SecFc(0/4) | MIC(0/4) | <------GPDF(1/n)------>
+exit:
+    return;
+}
 
-    /* clang-format on */
+void sl_gp_intf_tx_done(otError aError)
+{
+    otEXPECT(sGpTxSendingSlot != GP_TX_SLOT_INVALID);
 
-    bool     isGpPkt           = false;
-    uint8_t *gpFrameStartIndex = efr32GetPayload(aFrame);
-    otEXPECT_ACTION(gpFrameStartIndex != NULL, isGpPkt = false);
-    uint8_t fc = *gpFrameStartIndex;
+    if (aError == OT_ERROR_NONE)
+    {
+        sGpTxCounters[sGpTxSendingSlot].mHits++;
+    }
+    else
+    {
+        sGpTxCounters[sGpTxSendingSlot].mMisses++;
+    }
 
-    // Criteria:
-    //  - The basic Identification of a GPDF Frame : The minimum GPDF length need to be 10 in this case for any
-    //  direction
-    //  - Network layer FC containing the Protocol Version field as 3.
-    //  - The frame version should be 2003.
+    sl_gp_intf_response_done_cb(sGpTxSendingInstance, aError);
+    sGpTxSendingSlot     = GP_TX_SLOT_INVALID;
+    sGpTxSendingInstance = NULL;
 
-    bool lengthCheck         = (aFrame->mLength >= GP_MIN_MAINTENANCE_FRAME_LENGTH);
-    bool networkVersionCheck = GP_NWK_PROTOCOL_VERSION_CHECK(fc);
-    bool frameVersionCheck   = (efr32GetFrameVersion(aFrame) == IEEE802154_FRAME_VERSION_2003);
+    gpTxSendDeferred();
 
-    isGpPkt = (lengthCheck && networkVersionCheck && frameVersionCheck);
-#if 0 // Debugging
-    if (!isGpPkt)
+exit:
+    return;
+}
+
+otError sl_gp_intf_get_tx_slot_counters(uint8_t aSlot, sl_gp_tx_slot_counters_t *aCounters)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION((aSlot < GP_TX_TABLE_SIZE) && (aCounters != NULL), error = OT_ERROR_INVALID_ARGS);
+    *aCounters = sGpTxCounters[aSlot];
+
+exit:
+    return error;
+}
+
+void sl_gp_intf_clear_tx_slot_counters(void)
+{
+    memset(sGpTxCounters, 0, sizeof(sGpTxCounters));
+    memset(&sGpTxStats, 0, sizeof(sGpTxStats));
+}
+
+void sl_gp_intf_get_tx_stats(sl_gp_tx_stats_t *aStats)
+{
+    OT_ASSERT(aStats != NULL);
+
+    *aStats = sGpTxStats;
+
+    for (uint8_t i = 0; i < GP_TX_TABLE_SIZE; i++)
     {
-        otLogCritPlat("GP RCP INTF checks: Length = %d, NWK Version = %d, PanId Compression = %d, Frame Version = %d",
-                    lengthCheck,
-                    networkVersionCheck,
-                    panIdCompressionCheck,
-                    frameVersionCheck);
+        aStats->mHits     += sGpTxCounters[i].mHits;
+        aStats->mMisses   += sGpTxCounters[i].mMisses;
+        aStats->mTimeouts += sGpTxCounters[i].mTimeouts;
     }
-#endif
-exit:
-    return isGpPkt;
+}
+#endif // OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
+
+bool sl_gp_intf_is_gp_pkt(otRadioFrame *aFrame)
+{
+    efr32MacFrameInfo frameInfo;
+
+    return efr32ParseMacFrame(aFrame, &frameInfo) && gpIsGpFrame(aFrame, &frameInfo);
 }
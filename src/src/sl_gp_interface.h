@@ -47,9 +47,32 @@ typedef enum
     SL_GP_STATE_MAX
 } sl_gp_state_t;
 
+// Counters of a slot of the GP buffered transmit table
+typedef struct
+{
+    uint32_t mHits;     // Responses sent in the window following the request of their GPD.
+    uint32_t mMisses;   // Responses requested by their GPD but not sent in the window.
+    uint32_t mTimeouts; // Frames dropped as their GPD did not request them in time.
+} sl_gp_tx_slot_counters_t;
+
+// Statistics of the GP buffered transmit table, the hit rate of the response window is mHits / mRequests.
+typedef struct
+{
+    uint32_t mRequests;          // GPD requests matched to a buffered frame.
+    uint32_t mUnmatchedRequests; // GPD requests received while frames were buffered for other GPDs only.
+    uint32_t mScheduled;         // Responses armed ahead of their window.
+    uint32_t mDeferred;          // Responses which waited for the response to another GPD, and were sent late.
+    uint32_t mHits;              // Sum of the slot counters.
+    uint32_t mMisses;            // Sum of the slot counters.
+    uint32_t mTimeouts;          // Sum of the slot counters.
+} sl_gp_tx_stats_t;
+
 /**
  * This function returns current state of GP state machine.
  *
+ * With several frames buffered, SL_GP_STATE_SEND_RESPONSE is returned if any response is due, else
+ * SL_GP_STATE_WAITING_FOR_PKT.
+ *
  * @retval  Status of GP state machine.
  */
 sl_gp_state_t sl_gp_intf_get_state(void);
@@ -57,6 +80,9 @@ sl_gp_state_t sl_gp_intf_get_state(void);
 /**
  * This function performs GP RCP processing.
  *
+ * Only does work when a host is to be notified or a buffered frame timed out.
+ * The transmissions of the hosts are reported done from here once their frame is buffered.
+ *
  */
 void efr32GpProcess(void);
 
@@ -64,9 +90,18 @@ void efr32GpProcess(void);
  * This function stores the provided packet in global memory, to be sent as
  * a response for specific incoming packet.
  *
+ * A frame already buffered for the same GPD is replaced. The transmission of the host is reported done from
+ * efr32GpProcess() once the frame is buffered, the outcome of the response is reported later with
+ * sl_gp_intf_response_done_cb().
+ *
  * @param[in]  aInstance    A pointer to the OpenThread instance structure.
+ * @param[in]  aFrame       A pointer to the MAC frame buffer, for which sl_gp_intf_should_buffer_pkt() returned true.
+ *
+ * @retval  OT_ERROR_NONE          The frame is buffered.
+ * @retval  OT_ERROR_NO_BUFS       Frames are already buffered for SL_OPENTHREAD_GP_TX_TABLE_SIZE other GPDs.
+ * @retval  OT_ERROR_INVALID_ARGS  The frame is not a GP frame to buffer.
  */
-void sl_gp_intf_buffer_pkt(otInstance *aInstance);
+otError sl_gp_intf_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame);
 
 /**
  * This function returns if the given frame is a GP frame and should be buffered
@@ -80,6 +115,60 @@ void sl_gp_intf_buffer_pkt(otInstance *aInstance);
  */
 bool sl_gp_intf_should_buffer_pkt(otInstance *aInstance, otRadioFrame *aFrame, bool isRxFrame);
 
+/**
+ * This function checks if a received frame requests the response buffered by a host, in which case
+ * the response is scheduled.
+ *
+ * Cheap when no response is buffered, the frame is only parsed while waiting for a GP packet.
+ *
+ * @param[in]  aFrame       A pointer to the received MAC frame buffer.
+ */
+void sl_gp_intf_process_rx_pkt(otRadioFrame *aFrame);
+
+/**
+ * This callback reports the outcome of the response buffered by a host.
+ *
+ * Called with the status of the transmission once the response is sent, or with OT_ERROR_ABORT if the GPD did
+ * not request it in time, its response window was missed or another host replaced it. The outcomes are also
+ * accounted for in the slot counters. The default implementation does nothing, a host application can override
+ * it. It must not transmit.
+ *
+ * @param[in]  aInstance    The OpenThread instance of the host which buffered the response.
+ * @param[in]  aError       The outcome of the response.
+ */
+void sl_gp_intf_response_done_cb(otInstance *aInstance, otError aError);
+
+/**
+ * This function is called by the radio driver when a response sent with efr32RadioTransmitGpFrame() is done.
+ *
+ * @param[in]  aError       The status of the transmission.
+ */
+void sl_gp_intf_tx_done(otError aError);
+
+/**
+ * This function returns the counters of a slot of the GP buffered transmit table.
+ *
+ * @param[in]   aSlot       The index of the slot, below SL_OPENTHREAD_GP_TX_TABLE_SIZE.
+ * @param[out]  aCounters   A pointer to the counters to fill.
+ *
+ * @retval  OT_ERROR_NONE          The counters are returned.
+ * @retval  OT_ERROR_INVALID_ARGS  The slot index is out of range or @p aCounters is NULL.
+ */
+otError sl_gp_intf_get_tx_slot_counters(uint8_t aSlot, sl_gp_tx_slot_counters_t *aCounters);
+
+/**
+ * This function returns the statistics of the GP buffered transmit table.
+ *
+ * @param[out]  aStats      A pointer to the statistics to fill.
+ */
+void sl_gp_intf_get_tx_stats(sl_gp_tx_stats_t *aStats);
+
+/**
+ * This function clears the counters of all the slots of the GP buffered transmit table, and its statistics.
+ *
+ */
+void sl_gp_intf_clear_tx_slot_counters(void);
+
 /**
  * This function returns if the given frame is a GP frame.
  *
@@ -35,12 +35,85 @@
 #ifndef SL_PACKET_HANDLER_H
 #define SL_PACKET_HANDLER_H
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <openthread/platform/radio.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * This structure holds the layout of a MAC frame, found by efr32ParseMacFrame() in a single pass over the header.
+ *
+ * Offsets are from the start of the PSDU. As the Frame Control Field is at offset 0, an offset of 0 means the field
+ * is not present.
+ *
+ */
+typedef struct efr32MacFrameInfo
+{
+    uint16_t mFcf;            ///< Frame Control Field.
+    uint8_t  mDstPanIdOffset; ///< Destination PAN ID.
+    uint8_t  mDstAddrOffset;  ///< Destination address.
+    uint8_t  mDstAddrLength;  ///< Length of the destination address, 0, 2 or 8.
+    uint8_t  mSrcPanIdOffset; ///< Source PAN ID.
+    uint8_t  mSrcAddrOffset;  ///< Source address.
+    uint8_t  mSrcAddrLength;  ///< Length of the source address, 0, 2 or 8.
+    uint8_t  mSecurityOffset; ///< Auxiliary security header.
+    uint8_t  mIeOffset;       ///< First header IE.
+    uint8_t  mPayloadOffset;  ///< MAC payload, always present once parsed.
+    uint8_t  mPayloadLength;  ///< Length of the MAC payload.
+    uint8_t  mFooterLength;   ///< Length of the MIC and FCS.
+} efr32MacFrameInfo;
+
+/**
+ * This function parses the header of a MAC frame.
+ *
+ * The payload is located the same way as by OpenThread: after the header IEs and, in frames older than 2015, after
+ * the command identifier of MAC command frames. Multipurpose frames are not supported.
+ *
+ * @param[in]   aFrame      A pointer to the MAC frame buffer.
+ * @param[out]  aInfo       A pointer to the frame layout to fill.
+ *
+ * @retval  true    The frame was parsed.
+ * @retval  false   The frame is malformed or not supported, @p aInfo must not be used.
+ */
+bool efr32ParseMacFrame(const otRadioFrame *aFrame, efr32MacFrameInfo *aInfo);
+
+/**
+ * This function returns the start of payload pointer of a parsed frame.
+ *
+ * @param[in]  aFrame       A pointer to the MAC frame buffer.
+ * @param[in]  aInfo        The layout of the frame, see efr32ParseMacFrame().
+ *
+ * @retval  Pointer to start of 802.15.4 payload.
+ */
+static inline uint8_t *efr32MacFrameGetPayload(otRadioFrame *aFrame, const efr32MacFrameInfo *aInfo)
+{
+    return aFrame->mPsdu + aInfo->mPayloadOffset;
+}
+
+/**
+ * This function returns the Destination PanId of a parsed frame, if present.
+ *
+ * @param[in]  aFrame       A pointer to the MAC frame buffer.
+ * @param[in]  aInfo        The layout of the frame, see efr32ParseMacFrame().
+ *
+ * @retval  DstPanId    If present.
+ * @retval  BcastPanId  If Dest PanId is compressed.
+ */
+static inline otPanId efr32MacFrameGetDstPanId(const otRadioFrame *aFrame, const efr32MacFrameInfo *aInfo)
+{
+    otPanId panId = 0xFFFF;
+
+    if (aInfo->mDstPanIdOffset != 0)
+    {
+        panId = (otPanId)(aFrame->mPsdu[aInfo->mDstPanIdOffset] | (aFrame->mPsdu[aInfo->mDstPanIdOffset + 1] << 8));
+    }
+
+    return panId;
+}
+
 /**
  * This function performs AES CCM on the frame which is going to be sent.
  *
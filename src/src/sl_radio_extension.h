@@ -0,0 +1,742 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   EFR32 specific radio extension APIs, in addition to the ones declared in radio_extension.h.
+ */
+
+#ifndef SL_RADIO_EXTENSION_H_
+#define SL_RADIO_EXTENSION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <openthread/error.h>
+#include <openthread/radio_stats.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Width of the bins of the RSSI histograms, in dB. Bin N covers [-128 + 4N, -125 + 4N] dBm.
+ */
+#define EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM 4
+
+/**
+ * Number of bins of the RSSI histograms, covering the full int8_t dBm range.
+ */
+#define EFR32_RSSI_HISTOGRAM_BIN_COUNT (256 / EFR32_RSSI_HISTOGRAM_BIN_WIDTH_DBM)
+
+/**
+ * Maximum number of channels covered by an energy sweep, one per bit of the channel mask.
+ */
+#define EFR32_ENERGY_SWEEP_MAX_CHANNELS 32
+
+/**
+ * Energy measured on one channel of an energy sweep.
+ */
+typedef struct efr32EnergySweepResult
+{
+    uint8_t  mChannel;        ///< The channel.
+    int8_t   mMaxRssi;        ///< Highest RSSI sample, in dBm.
+    int8_t   mMeanRssi;       ///< Mean of the RSSI samples, in dBm.
+    int8_t   mPercentileRssi; ///< SL_OPENTHREAD_ENERGY_SWEEP_PERCENTILE percentile of the samples, in dBm.
+    uint32_t mSampleCount;    ///< Number of RSSI samples taken on the channel.
+} efr32EnergySweepResult;
+
+/**
+ * Start an energy sweep over several channels.
+ *
+ * The channels are scanned back to back, without going through the main loop or the host in between.
+ * When the sweep completes, otPlatRadioExtensionEnergySweepDone() is called from the main loop.
+ *
+ * All the channels in @p aChannelMask must belong to the band currently in use.
+ *
+ * @param[in]  aChannelMask  A mask of the channels to scan, bit N selecting channel N.
+ * @param[in]  aDwellTimeMs  The time to spend on each channel, in milliseconds.
+ *
+ * @retval OT_ERROR_NONE          Successfully started the sweep.
+ * @retval OT_ERROR_BUSY          The radio is transmitting or scanning.
+ * @retval OT_ERROR_INVALID_ARGS  The channel mask or dwell time is not valid.
+ * @retval OT_ERROR_FAILED        The radio could not be configured for the sweep.
+ */
+otError otPlatRadioExtensionStartEnergySweep(uint32_t aChannelMask, uint16_t aDwellTimeMs);
+
+/**
+ * Get the results of the last completed energy sweep.
+ *
+ * @param[out]     aResults     An array receiving one entry per scanned channel, in channel order.
+ * @param[in,out]  aNumEntries  On input, the number of entries in @p aResults. On output, the number
+ *                              of entries written.
+ *
+ * @retval OT_ERROR_NONE          Successfully copied the results.
+ * @retval OT_ERROR_INVALID_ARGS  @p aResults or @p aNumEntries is NULL.
+ * @retval OT_ERROR_BUSY          A sweep is in progress.
+ */
+otError otPlatRadioExtensionGetEnergySweepResults(efr32EnergySweepResult *aResults, uint8_t *aNumEntries);
+
+/**
+ * Callback invoked from the main loop when an energy sweep completes.
+ *
+ * Weakly defined, applications may override it to get notified.
+ *
+ * @param[in]  aNumEntries  The number of channels scanned.
+ */
+void otPlatRadioExtensionEnergySweepDone(uint8_t aNumEntries);
+
+/**
+ * Statistics of the background noise floor monitor.
+ */
+typedef struct efr32NoiseFloorStats
+{
+    uint8_t  mChannel;         ///< The channel the rolling window was sampled on.
+    int8_t   mNoiseFloor;      ///< Noise floor estimate over the rolling window, in dBm.
+    uint16_t mBusyRatio;       ///< Share of rolling window samples at or above the CCA threshold, in 1/10000.
+    uint32_t mSampleCount;     ///< Samples taken since the statistics were cleared.
+    uint32_t mBusySampleCount; ///< Samples at or above the CCA threshold since the statistics were cleared.
+    uint32_t mHistogram[EFR32_RSSI_HISTOGRAM_BIN_COUNT]; ///< Rolling window histogram of the samples.
+} efr32NoiseFloorStats;
+
+/**
+ * Set the sampling interval of the background noise floor monitor.
+ *
+ * While the radio listens on a channel, without receiving a frame, transmitting or scanning, the RSSI
+ * is sampled every @p aIntervalUs. The rolling window is restarted whenever the channel changes. The
+ * sampling timer is stopped while the radio is idle or asleep.
+ *
+ * @param[in]  aIntervalUs  The sampling interval in microseconds, 0 to stop the monitor.
+ *
+ * @retval OT_ERROR_NONE             Successfully updated the sampling interval.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE is not set.
+ */
+otError otPlatRadioExtensionSetNoiseFloorMonitorInterval(uint32_t aIntervalUs);
+
+/**
+ * Get the statistics of the background noise floor monitor.
+ *
+ * @param[out]  aStats  A pointer to the statistics to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the statistics.
+ * @retval OT_ERROR_INVALID_ARGS     @p aStats is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetNoiseFloorStats(efr32NoiseFloorStats *aStats);
+
+/**
+ * Clear the statistics of the background noise floor monitor.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the statistics.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_NOISE_FLOOR_MONITOR_ENABLE is not set.
+ */
+otError otPlatRadioExtensionClearNoiseFloorStats(void);
+
+/**
+ * Number of bins of the coex request to grant latency histograms. Bin 0 counts latencies below 2 us, bin N
+ * latencies in [2^N, 2^(N+1)) us and the last bin all the longer ones.
+ */
+#define EFR32_COEX_LATENCY_HISTOGRAM_BIN_COUNT 16
+
+/**
+ * Log-scale histogram of the coex request to grant latencies of one direction.
+ */
+typedef struct efr32CoexLatencyHistogram
+{
+    uint32_t mBins[EFR32_COEX_LATENCY_HISTOGRAM_BIN_COUNT]; ///< Saturating count of grants per latency bin.
+    uint32_t mMaxUs;                                         ///< Longest latency observed, in microseconds.
+} efr32CoexLatencyHistogram;
+
+/**
+ * A coex event recorded in the event ring.
+ */
+typedef struct efr32CoexEvent
+{
+    uint32_t mTimestampUs; ///< Time of the event, in microseconds.
+    uint32_t mLatencyUs;   ///< Request to grant latency for grant events, 0 otherwise.
+    uint8_t  mEvent;       ///< The sl_rail_util_coex_ot_event_t event, without the request direction bits.
+    bool     mIsTx;        ///< TRUE for a tx request, FALSE for a rx request.
+} efr32CoexEvent;
+
+/**
+ * Get the coex request to grant latency histograms.
+ *
+ * Companion of otPlatRadioExtensionGetCoexCounters(), whose fixed layout only carries the PTA event counts.
+ *
+ * @param[out]  aTxHistogram  A pointer to the histogram receiving the tx request latencies.
+ * @param[out]  aRxHistogram  A pointer to the histogram receiving the rx request latencies.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the histograms.
+ * @retval OT_ERROR_INVALID_ARGS     @p aTxHistogram or @p aRxHistogram is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetCoexLatencyHistograms(efr32CoexLatencyHistogram *aTxHistogram,
+                                                     efr32CoexLatencyHistogram *aRxHistogram);
+
+/**
+ * Get the most recent coex events.
+ *
+ * The last SL_OPENTHREAD_COEX_EVENT_RING_SIZE events are kept, older ones are overwritten.
+ *
+ * @param[out]     aEvents       An array receiving the events, oldest first.
+ * @param[in,out]  aNumEntries   On input, the number of entries in @p aEvents. On output, the number of
+ *                               entries written.
+ * @param[out]     aTotalEvents  Optional, receives the number of events recorded since the last reset, which
+ *                               tells how many were overwritten.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the events.
+ * @retval OT_ERROR_INVALID_ARGS     @p aEvents or @p aNumEntries is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetCoexEvents(efr32CoexEvent *aEvents, uint8_t *aNumEntries, uint32_t *aTotalEvents);
+
+/**
+ * Radio events recorded in the radio trace.
+ *
+ * The flags of the transmit events hold the MAC sequence number of the frame being sent. The flags of
+ * EFR32_RADIO_TRACE_TX_DONE and EFR32_RADIO_TRACE_RECEIVE_DONE hold the otError reported to the stack.
+ */
+typedef enum efr32RadioTraceEvent
+{
+    // Recorded from the RAIL event callback.
+    EFR32_RADIO_TRACE_RX_SYNC              = 1,  ///< Sync word detected.
+    EFR32_RADIO_TRACE_RX_FILTER_PASSED     = 2,  ///< Received frame passed the address filter.
+    EFR32_RADIO_TRACE_RX_DATA_REQUEST      = 3,  ///< Data request command received.
+    EFR32_RADIO_TRACE_RX_PACKET_RECEIVED   = 4,  ///< Frame received.
+    EFR32_RADIO_TRACE_RX_FRAME_ERROR       = 5,  ///< Frame received with a CRC error.
+    EFR32_RADIO_TRACE_RX_FILTERED          = 6,  ///< Frame aborted, filtered or dropped on FIFO overflow.
+    EFR32_RADIO_TRACE_TX_START_CCA         = 7,  ///< CCA attempt started.
+    EFR32_RADIO_TRACE_TX_CCA_RETRY         = 8,  ///< CCA attempt found the channel busy, backing off.
+    EFR32_RADIO_TRACE_TX_STARTED           = 9,  ///< Channel clear, frame going on air.
+    EFR32_RADIO_TRACE_TX_PACKET_SENT       = 10, ///< Frame sent.
+    EFR32_RADIO_TRACE_TX_CHANNEL_BUSY      = 11, ///< Transmission failed channel access.
+    EFR32_RADIO_TRACE_TX_BLOCKED           = 12, ///< Transmission blocked.
+    EFR32_RADIO_TRACE_TX_ABORTED           = 13, ///< Transmission aborted or underflowed.
+    EFR32_RADIO_TRACE_TX_ACK_TIMEOUT       = 14, ///< No acknowledgment received for the frame.
+    EFR32_RADIO_TRACE_TXACK_SENT           = 15, ///< Acknowledgment sent for a received frame.
+    EFR32_RADIO_TRACE_TXACK_FAILED         = 16, ///< Acknowledgment aborted, underflowed or blocked.
+    EFR32_RADIO_TRACE_SCHEDULED_TX_STARTED = 17, ///< Scheduled transmission started.
+    EFR32_RADIO_TRACE_SCHEDULED_TX_MISSED  = 18, ///< Scheduled transmission missed.
+    EFR32_RADIO_TRACE_SCHEDULED_RX_STARTED = 19, ///< Scheduled receive window started.
+    EFR32_RADIO_TRACE_SCHEDULED_RX_END     = 20, ///< Scheduled receive window ended or missed.
+    EFR32_RADIO_TRACE_SCHEDULER_STATUS     = 21, ///< RAIL scheduler status event, flags hold the status.
+    EFR32_RADIO_TRACE_CAL_NEEDED           = 22, ///< Calibration performed.
+
+    // Recorded from the main loop.
+    EFR32_RADIO_TRACE_TRANSMIT     = 32, ///< otPlatRadioTransmit() called.
+    EFR32_RADIO_TRACE_TX_DONE      = 33, ///< otPlatRadioTxDone() about to be called.
+    EFR32_RADIO_TRACE_RECEIVE_DONE = 34, ///< otPlatRadioReceiveDone() about to be called.
+} efr32RadioTraceEvent;
+
+/**
+ * An entry of the radio trace.
+ */
+typedef struct efr32RadioTraceEntry
+{
+    uint32_t mTimestamp; ///< RAIL time of the event, in microseconds.
+    uint8_t  mEvent;     ///< The event, one of efr32RadioTraceEvent.
+    uint8_t  mIid;       ///< The interface index the event relates to, 0 if unknown.
+    uint16_t mFlags;     ///< Event specific flags.
+} efr32RadioTraceEntry;
+
+/**
+ * Get the most recent entries of the radio trace.
+ *
+ * The trace keeps the last SL_OPENTHREAD_RADIO_TRACE_BUFFER_SIZE entries. `script/analyze_radio_trace.py`
+ * turns them into per-frame timelines.
+ *
+ * @param[out]     aEntries       An array receiving the entries, oldest first.
+ * @param[in,out]  aNumEntries    On input, the number of entries in @p aEntries. On output, the number of
+ *                                entries written.
+ * @param[out]     aTotalEntries  Optional, receives the number of entries recorded since the trace was cleared.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the entries.
+ * @retval OT_ERROR_INVALID_ARGS     @p aEntries or @p aNumEntries is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_TRACE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetRadioTrace(efr32RadioTraceEntry *aEntries,
+                                          uint16_t             *aNumEntries,
+                                          uint32_t             *aTotalEntries);
+
+/**
+ * Clear the radio trace.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the trace.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_TRACE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionClearRadioTrace(void);
+
+/**
+ * Number of bins of the transmit latency histograms. Bin 0 counts latencies below 2 us, bin N latencies in
+ * [2^N, 2^(N+1)) us and the last bin all the longer ones.
+ */
+#define EFR32_TX_LATENCY_HISTOGRAM_BIN_COUNT 16
+
+/**
+ * Number of bins of the CSMA backoff histogram. Bin N counts the frames sent after N backoffs, the last bin
+ * all the frames which needed more.
+ */
+#define EFR32_TX_CSMA_HISTOGRAM_BIN_COUNT 8
+
+/**
+ * Transmit statistics of one interface.
+ */
+typedef struct efr32TxStats
+{
+    uint32_t mTxCount;                                              ///< Transmissions reported to the stack.
+    uint32_t mCcaFailCount;                                         ///< Transmissions which failed channel access.
+    uint32_t mNoAckCount;                                           ///< Transmissions which were not acknowledged.
+    uint32_t mScheduledTxCount;                                     ///< Transmissions started at a target time.
+    uint32_t mScheduledTxMissedCount;                               ///< Of those, the ones which missed their time.
+    uint32_t mEnqueueToStart[EFR32_TX_LATENCY_HISTOGRAM_BIN_COUNT]; ///< Request (incl. pending queue) to on air.
+    uint32_t mStartToDone[EFR32_TX_LATENCY_HISTOGRAM_BIN_COUNT];    ///< On air to completion reported to the stack.
+    uint32_t mAckWait[EFR32_TX_LATENCY_HISTOGRAM_BIN_COUNT];        ///< End of the frame to end of its ACK.
+    uint32_t mCsmaBackoffs[EFR32_TX_CSMA_HISTOGRAM_BIN_COUNT];      ///< CSMA backoffs per transmission.
+    uint32_t mMaxEnqueueToStartUs;                                  ///< Longest request to on air latency, in us.
+    uint32_t mMaxStartToDoneUs;                                     ///< Longest on air to completion latency, in us.
+    uint32_t mMaxAckWaitUs;                                         ///< Longest ACK wait, in us.
+} efr32TxStats;
+
+/**
+ * Get the transmit statistics of an interface.
+ *
+ * @param[in]   aIid    The interface index, 0 on single interface builds.
+ * @param[out]  aStats  A pointer to the statistics to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the statistics.
+ * @retval OT_ERROR_INVALID_ARGS     @p aStats is NULL or @p aIid is not a valid interface index.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_TX_STATS_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetTxStats(uint8_t aIid, efr32TxStats *aStats);
+
+/**
+ * Clear the transmit statistics of all the interfaces.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the statistics.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_TX_STATS_ENABLE is not set.
+ */
+otError otPlatRadioExtensionClearTxStats(void);
+
+/**
+ * Counters of the adaptive CCA threshold controller.
+ */
+typedef struct efr32AdaptiveCcaCounters
+{
+    int8_t   mThresholdDbm;  ///< The CCA energy detect threshold currently in use, in dBm.
+    int8_t   mNoiseFloorDbm; ///< Noise floor used at the last adjustment, OT_RADIO_RSSI_INVALID if unknown.
+    uint32_t mWindowCount;   ///< Number of evaluation windows completed.
+    uint32_t mRaisedCount;   ///< Number of times the threshold was raised.
+    uint32_t mLoweredCount;  ///< Number of times the threshold was lowered.
+    uint32_t mClampedCount;  ///< Number of adjustments limited by the configured bounds.
+    uint32_t mTxCount;       ///< Number of transmissions evaluated.
+    uint32_t mCcaFailCount;  ///< Number of transmissions which failed channel access.
+    uint32_t mNoAckCount;    ///< Number of transmissions which were not acknowledged.
+} efr32AdaptiveCcaCounters;
+
+/**
+ * Enable or disable the adaptive CCA threshold controller.
+ *
+ * The controller evaluates the transmissions by windows of SL_OPENTHREAD_ADAPTIVE_CCA_WINDOW frames. At the end
+ * of a window, the threshold is lowered if too many frames were not acknowledged, raised if channel access failed
+ * too often, and otherwise moved towards the noise floor plus SL_OPENTHREAD_ADAPTIVE_CCA_NOISE_MARGIN_DB. The
+ * threshold always stays within SL_OPENTHREAD_ADAPTIVE_CCA_MIN_DBM and SL_OPENTHREAD_ADAPTIVE_CCA_MAX_DBM.
+ *
+ * The controller starts disabled. When disabled, the threshold last selected stays in use until
+ * otPlatRadioSetCcaEnergyDetectThreshold() is called. Setting a threshold with
+ * otPlatRadioSetCcaEnergyDetectThreshold() also disables the controller.
+ *
+ * @param[in]  aEnabled  TRUE to enable the controller, FALSE to disable it.
+ *
+ * @retval OT_ERROR_NONE             Successfully updated the controller state.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE is not set.
+ */
+otError otPlatRadioExtensionSetAdaptiveCcaEnabled(bool aEnabled);
+
+/**
+ * Get the counters of the adaptive CCA threshold controller.
+ *
+ * @param[out]  aCounters  A pointer to the counters to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the counters.
+ * @retval OT_ERROR_INVALID_ARGS     @p aCounters is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetAdaptiveCcaCounters(efr32AdaptiveCcaCounters *aCounters);
+
+/**
+ * Clear the counters of the adaptive CCA threshold controller.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the counters.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_ADAPTIVE_CCA_ENABLE is not set.
+ */
+otError otPlatRadioExtensionClearAdaptiveCcaCounters(void);
+
+/**
+ * Number of channels tracked by the radio counters, frames on channels from this one up are only counted by
+ * interface.
+ */
+#define EFR32_RADIO_COUNTERS_CHANNEL_COUNT 32
+
+/**
+ * Number of interfaces tracked by the radio counters.
+ */
+#define EFR32_RADIO_COUNTERS_INTERFACE_COUNT 4
+
+/**
+ * Frame counters of one channel or one interface.
+ *
+ * The counters are never reset and wrap around, the activity over a period is the difference between two
+ * snapshots, see otPlatRadioExtensionGetRadioCountersDelta().
+ */
+typedef struct efr32RadioFrameCounters
+{
+    uint32_t mRxAccepted; ///< Frames received and handed to the stack, ACKs excluded.
+    uint32_t mRxDropped;  ///< Frames received but dropped, for lack of buffers or as malformed.
+    uint32_t mTxSuccess;  ///< Transmissions which succeeded.
+    uint32_t mTxCcaFail;  ///< Transmissions which failed channel access.
+    uint32_t mTxNoAck;    ///< Transmissions which were not acknowledged.
+    uint32_t mEnhAckFail; ///< Enhanced ACKs which could not be generated or handed to the radio.
+} efr32RadioFrameCounters;
+
+/**
+ * Snapshot of the radio counters.
+ */
+typedef struct efr32RadioCountersSnapshot
+{
+    uint32_t                mTimestamp;                                      ///< Time of the snapshot, in ms.
+    efr32RadioFrameCounters mChannel[EFR32_RADIO_COUNTERS_CHANNEL_COUNT];     ///< Counters indexed by channel.
+    efr32RadioFrameCounters mInterface[EFR32_RADIO_COUNTERS_INTERFACE_COUNT]; ///< Counters indexed by interface.
+} efr32RadioCountersSnapshot;
+
+/**
+ * Take a snapshot of the radio counters.
+ *
+ * The counters are copied at once, so the channel and interface counters of a snapshot are consistent with
+ * each other. Taking a snapshot does not modify the counters, so several users can follow them independently.
+ *
+ * @param[out]  aSnapshot  A pointer to the snapshot to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully took the snapshot.
+ * @retval OT_ERROR_INVALID_ARGS     @p aSnapshot is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_COUNTERS_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetRadioCountersSnapshot(efr32RadioCountersSnapshot *aSnapshot);
+
+/**
+ * Get the radio activity since a previous snapshot.
+ *
+ * Takes a new snapshot, stores the difference with @p aPrevious in @p aDelta, then replaces @p aPrevious with
+ * the new snapshot so the next call reports the activity from now on. The timestamp of @p aDelta holds the
+ * length of the period, in ms.
+ *
+ * @param[in,out]  aPrevious  A pointer to the previous snapshot, updated to the new one.
+ * @param[out]     aDelta     A pointer to the counter differences to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully computed the differences.
+ * @retval OT_ERROR_INVALID_ARGS     @p aPrevious or @p aDelta is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_COUNTERS_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetRadioCountersDelta(efr32RadioCountersSnapshot *aPrevious,
+                                                  efr32RadioCountersSnapshot *aDelta);
+
+/**
+ * Radio states tracked by the residency accounting.
+ */
+typedef enum efr32RadioResidencyState
+{
+    EFR32_RADIO_RESIDENCY_SLEEP        = 0, ///< Radio idle.
+    EFR32_RADIO_RESIDENCY_RX           = 1, ///< Background receive.
+    EFR32_RADIO_RESIDENCY_SCHEDULED_RX = 2, ///< Scheduled receive window, such as a CSL sample.
+    EFR32_RADIO_RESIDENCY_TX           = 3, ///< Frame transmission, including the CSMA backoffs and ACK wait.
+    EFR32_RADIO_RESIDENCY_ACK_TX       = 4, ///< Acknowledgment transmission.
+    EFR32_RADIO_RESIDENCY_ENERGY_SCAN  = 5, ///< Energy scan.
+    EFR32_RADIO_RESIDENCY_STATE_COUNT  = 6, ///< Number of tracked states.
+} efr32RadioResidencyState;
+
+/**
+ * Cumulative time spent by the radio in each state.
+ */
+typedef struct efr32RadioResidency
+{
+    uint64_t mTimeUs[EFR32_RADIO_RESIDENCY_STATE_COUNT]; ///< Time spent in each state, in microseconds.
+    uint32_t mTransitionCount;                           ///< Number of state transitions.
+    uint8_t  mState;                                     ///< The current state, see efr32RadioResidencyState.
+} efr32RadioResidency;
+
+/**
+ * Get the time spent by the radio in each state since it was initialized or the residency was cleared.
+ *
+ * The time spent in the current state up to now is included.
+ *
+ * @param[out]  aResidency  A pointer to the residency to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the residency.
+ * @retval OT_ERROR_INVALID_ARGS     @p aResidency is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetRadioResidency(efr32RadioResidency *aResidency);
+
+/**
+ * Get the radio residency in the OpenThread radio time statistics format.
+ *
+ * Transmissions and acknowledgments are reported as transmit time, background and scheduled receive and
+ * energy scans as receive time. The radio is never reported as disabled once initialized.
+ *
+ * @param[out]  aStats  A pointer to the statistics to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the statistics.
+ * @retval OT_ERROR_INVALID_ARGS     @p aStats is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetRadioTimeStats(otRadioTimeStats *aStats);
+
+/**
+ * Clear the radio residency.
+ *
+ * @retval OT_ERROR_NONE             Successfully cleared the residency.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_RADIO_RESIDENCY_ENABLE is not set.
+ */
+otError otPlatRadioExtensionClearRadioResidency(void);
+
+/**
+ * Radio reconfiguration counters.
+ *
+ * Back-to-back operations on the same band at the same transmit power reuse the configuration already applied
+ * to RAIL, these counters report how often a band configuration load or a transmit power write was avoided.
+ */
+typedef struct efr32RadioReconfigCounters
+{
+    uint32_t mBandConfigLoads;        // Number of band configurations loaded in RAIL.
+    uint32_t mBandConfigLoadsAvoided; // Number of band configuration loads skipped, the band was already loaded.
+    uint32_t mTxPowerWrites;          // Number of transmit powers written to RAIL.
+    uint32_t mTxPowerWritesAvoided;   // Number of transmit power writes skipped, the power was already applied.
+} efr32RadioReconfigCounters;
+
+/**
+ * Get the radio reconfiguration counters.
+ *
+ * @param[out]  aCounters  A pointer to the counters to fill.
+ *
+ * @retval OT_ERROR_NONE          Successfully copied the counters.
+ * @retval OT_ERROR_INVALID_ARGS  @p aCounters is NULL.
+ */
+otError otPlatRadioExtensionGetRadioReconfigCounters(efr32RadioReconfigCounters *aCounters);
+
+/**
+ * Clear the radio reconfiguration counters.
+ *
+ * @retval OT_ERROR_NONE  Successfully cleared the counters.
+ */
+otError otPlatRadioExtensionClearRadioReconfigCounters(void);
+
+/**
+ * CSL clock drift learned against the parent.
+ */
+typedef struct efr32CslDriftEstimate
+{
+    uint32_t mSampleCount; // Number of frames received in CSL windows used for the estimate.
+    uint16_t mDriftPpm;    // Learned drift, in ppm, rounded up.
+    uint8_t  mAccuracy;    // CSL accuracy currently reported to the stack, in ppm.
+} efr32CslDriftEstimate;
+
+/**
+ * Get the CSL clock drift learned against the parent.
+ *
+ * @param[out]  aEstimate  A pointer to the estimate to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the estimate.
+ * @retval OT_ERROR_INVALID_ARGS     @p aEstimate is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_CSL_DRIFT_LEARNING_ENABLE or the CSL receiver is not enabled.
+ */
+otError otPlatRadioExtensionGetCslDriftEstimate(efr32CslDriftEstimate *aEstimate);
+
+/**
+ * A scheduled receive window.
+ */
+typedef struct efr32RxWindow
+{
+    uint32_t mStart;    // Start of the window, in microseconds of the radio time.
+    uint32_t mDuration; // Duration of the window, in microseconds.
+    uint8_t  mChannel;  // Channel to receive on.
+} efr32RxWindow;
+
+/**
+ * Scheduled receive window counters.
+ */
+typedef struct efr32ScheduledRxStats
+{
+    uint32_t mQueued;    // Windows queued.
+    uint32_t mMerged;    // Windows already covered by a pending window, not queued again.
+    uint32_t mRejected;  // Windows rejected because the queue was full.
+    uint32_t mArmed;     // Windows armed in RAIL, including the re-armed ones.
+    uint32_t mCompleted; // Windows which ran until their end.
+    uint32_t mResumed;   // Windows interrupted, by a transmission or another protocol, then re-armed.
+    uint32_t mMissed;    // Windows which ended before they could be armed, or failed to be armed.
+} efr32ScheduledRxStats;
+
+/**
+ * Queue scheduled receive windows.
+ *
+ * The windows are kept ordered by start time and armed back-to-back, in the same queue as the windows requested
+ * with otPlatRadioReceiveAt(). A transmission takes precedence over a window, the window is armed again for its
+ * remaining time once the transmission is done. Putting the radio to sleep or switching it to continuous receive
+ * discards all the pending windows.
+ *
+ * @param[in]  aWindows  An array of windows.
+ * @param[in]  aCount    The number of windows in @p aWindows.
+ *
+ * @retval OT_ERROR_NONE             Successfully queued the windows.
+ * @retval OT_ERROR_INVALID_ARGS     @p aWindows is NULL or a window is on an unsupported channel.
+ * @retval OT_ERROR_NO_BUFS          The queue cannot hold all the windows, none was queued.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  Scheduled receive is not supported by this build.
+ */
+otError otPlatRadioExtensionScheduleRxWindows(const efr32RxWindow *aWindows, uint8_t aCount);
+
+/**
+ * Get the scheduled receive window counters.
+ *
+ * @param[out]  aStats  A pointer to the counters to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the counters.
+ * @retval OT_ERROR_INVALID_ARGS     @p aStats is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  Scheduled receive is not supported by this build.
+ */
+otError otPlatRadioExtensionGetScheduledRxStats(efr32ScheduledRxStats *aStats);
+
+/**
+ * Size of the header of a sniffer capture batch, see otPlatRadioExtensionReadSnifferCapture().
+ */
+#define EFR32_SNIFFER_CAPTURE_BATCH_HEADER_SIZE 8
+
+/**
+ * Size of the header of a sniffer capture record, see otPlatRadioExtensionReadSnifferCapture().
+ */
+#define EFR32_SNIFFER_CAPTURE_RECORD_HEADER_SIZE 12
+
+/**
+ * Sniffer capture counters, since the capture was started.
+ */
+typedef struct efr32SnifferCaptureCounters
+{
+    uint32_t mCaptured;    // Frames written to the capture buffer.
+    uint32_t mDropped;     // Frames dropped because the capture buffer was full.
+    uint32_t mRxOverflows; // Frames lost by the receiver, on a receive FIFO overflow.
+    uint32_t mBatches;     // Batches read.
+} efr32SnifferCaptureCounters;
+
+/**
+ * Start a sniffer capture.
+ *
+ * The radio is put in promiscuous receive on the given channels and every received frame is written to the
+ * capture buffer, with its timestamp, RSSI, LQI and channel. The frames are not reported with
+ * otPlatRadioReceiveDone(), the host reads them in batches with otPlatRadioExtensionReadSnifferCapture().
+ *
+ * Listening on several channels at once relies on the RAIL fast channel switching, the channels must then be in
+ * the same band. While the capture is running, otPlatRadioReceive(), otPlatRadioReceiveAt() and
+ * otPlatRadioSleep() are rejected so that the receiver stays on the capture channels.
+ *
+ * @param[in]  aChannels     An array of channels to capture on.
+ * @param[in]  aNumChannels  The number of channels in @p aChannels.
+ *
+ * @retval OT_ERROR_NONE             Successfully started the capture, the counters were cleared.
+ * @retval OT_ERROR_INVALID_ARGS     @p aChannels is NULL or empty, or holds an unsupported channel.
+ * @retval OT_ERROR_NOT_CAPABLE      Several channels were given but fast channel switching is not available, or
+ *                                   they are not in the same band.
+ * @retval OT_ERROR_BUSY             A transmission or an energy scan is in progress.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionStartSnifferCapture(const uint8_t *aChannels, uint8_t aNumChannels);
+
+/**
+ * Stop the sniffer capture.
+ *
+ * The promiscuous mode set with otPlatRadioSetPromiscuous() is restored and the radio returns to the channel and
+ * the receive or sleep state it was in when the capture started. The frames remaining in the capture buffer can
+ * still be read.
+ *
+ * @retval OT_ERROR_NONE             Successfully stopped the capture.
+ * @retval OT_ERROR_FAILED           The capture is stopped, but the radio could not return to receive.
+ * @retval OT_ERROR_INVALID_STATE    No capture is running.
+ * @retval OT_ERROR_BUSY             A transmission is in progress.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionStopSnifferCapture(void);
+
+/**
+ * Read a batch of captured frames.
+ *
+ * The batch holds as many of the oldest captured frames as fit in @p aBuffer, and is returned even when empty
+ * so that the host learns about the dropped frames. Multi-byte fields are little endian.
+ *
+ * Batch header:
+ *
+ *   | Offset | Size | Field                                                         |
+ *   |--------|------|---------------------------------------------------------------|
+ *   | 0      | 2    | Batch sequence number, incremented for each batch read        |
+ *   | 2      | 2    | Number of records following the header                        |
+ *   | 4      | 4    | Frames dropped or lost since the previous batch               |
+ *
+ * Each record:
+ *
+ *   | Offset | Size | Field                                                         |
+ *   |--------|------|---------------------------------------------------------------|
+ *   | 0      | 1    | Frame length N, without the FCS which RAIL does not keep      |
+ *   | 1      | 1    | Channel                                                       |
+ *   | 2      | 1    | RSSI, in dBm (signed)                                         |
+ *   | 3      | 1    | LQI                                                           |
+ *   | 4      | 8    | Time of the end of the SFD, in microseconds (otPlatTimeGet()) |
+ *   | 12     | N    | Frame, from the MAC header to the end of the payload          |
+ *
+ * `script/sniffer_capture_to_pcap.py` converts the batches to a pcap file.
+ *
+ * @param[out]  aBuffer        A buffer receiving the batch.
+ * @param[in]   aBufferLength  The length of @p aBuffer, at least EFR32_SNIFFER_CAPTURE_BATCH_HEADER_SIZE.
+ * @param[out]  aBatchLength   Receives the length of the batch.
+ *
+ * @retval OT_ERROR_NONE             Successfully read a batch.
+ * @retval OT_ERROR_INVALID_ARGS     @p aBuffer or @p aBatchLength is NULL, or @p aBuffer is too short.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionReadSnifferCapture(uint8_t *aBuffer, uint16_t aBufferLength, uint16_t *aBatchLength);
+
+/**
+ * Get the sniffer capture counters.
+ *
+ * @param[out]  aCounters  A pointer to the counters to fill.
+ *
+ * @retval OT_ERROR_NONE             Successfully copied the counters.
+ * @retval OT_ERROR_INVALID_ARGS     @p aCounters is NULL.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE is not set.
+ */
+otError otPlatRadioExtensionGetSnifferCaptureCounters(efr32SnifferCaptureCounters *aCounters);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SL_RADIO_EXTENSION_H_
@@ -149,6 +149,10 @@ static bool isPlatformEventPending(void)
     isPending = isPending || efr32UartIsDataReady();
 #endif
 
+#if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED) && SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    isPending = isPending || efr32LogIsPending();
+#endif
+
     return isPending;
 }
 
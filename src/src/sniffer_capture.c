@@ -0,0 +1,197 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ring of the frames received in sniffer capture mode.
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread-core-config.h>
+
+#include "em_core.h"
+#include "sniffer_capture.h"
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+
+#define EFR32_SNIFFER_CAPTURE_MASK (SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE - 1U)
+
+typedef struct efr32SnifferCapture
+{
+    uint8_t                     mBuffer[SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE];
+    volatile uint32_t           mHead;              // Bytes written, the next record goes to mBuffer[mHead & mask].
+    volatile uint32_t           mTail;              // Bytes read, the oldest record is at mBuffer[mTail & mask].
+    uint32_t                    mPending;           // Bytes of the record being written, not yet committed.
+    uint32_t                    mDroppedSinceBatch; // Frames dropped since the last batch was read.
+    uint16_t                    mBatchSequence;     // Sequence number of the next batch.
+    efr32SnifferCaptureCounters mCounters;
+} efr32SnifferCapture;
+
+static efr32SnifferCapture sSnifferCapture;
+
+static inline void efr32SnifferCapturePut32(uint8_t *aBuffer, uint32_t aValue)
+{
+    aBuffer[0] = (uint8_t)aValue;
+    aBuffer[1] = (uint8_t)(aValue >> 8);
+    aBuffer[2] = (uint8_t)(aValue >> 16);
+    aBuffer[3] = (uint8_t)(aValue >> 24);
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+uint8_t *efr32SnifferCaptureAlloc(uint8_t aLength, uint64_t aTimestamp, int8_t aRssi, uint8_t aLqi, uint8_t aChannel)
+{
+    uint32_t size    = EFR32_SNIFFER_CAPTURE_RECORD_HEADER_SIZE + aLength;
+    uint32_t head    = sSnifferCapture.mHead;
+    uint32_t offset  = head & EFR32_SNIFFER_CAPTURE_MASK;
+    uint32_t room    = SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE - offset;
+    uint32_t padding = (room < size) ? room : 0;
+    uint8_t *record  = NULL;
+
+    if ((head - sSnifferCapture.mTail) + padding + size > SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE)
+    {
+        sSnifferCapture.mCounters.mDropped++;
+        sSnifferCapture.mDroppedSinceBatch++;
+    }
+    else
+    {
+        if (padding != 0)
+        {
+            sSnifferCapture.mBuffer[offset] = 0;
+            sSnifferCapture.mHead           = head + padding;
+            offset                          = 0;
+        }
+
+        record    = &sSnifferCapture.mBuffer[offset];
+        record[0] = aLength;
+        record[1] = aChannel;
+        record[2] = (uint8_t)aRssi;
+        record[3] = aLqi;
+        efr32SnifferCapturePut32(&record[4], (uint32_t)aTimestamp);
+        efr32SnifferCapturePut32(&record[8], (uint32_t)(aTimestamp >> 32));
+
+        sSnifferCapture.mPending = size;
+        record += EFR32_SNIFFER_CAPTURE_RECORD_HEADER_SIZE;
+    }
+
+    return record;
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+void efr32SnifferCaptureCommit(void)
+{
+    uint32_t size = sSnifferCapture.mPending;
+
+    sSnifferCapture.mPending = 0;
+    sSnifferCapture.mHead    = sSnifferCapture.mHead + size;
+    sSnifferCapture.mCounters.mCaptured++;
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_OT_PLATFORM_ABSTRACTION, SL_CODE_CLASS_TIME_CRITICAL)
+void efr32SnifferCaptureOnRxOverflow(void)
+{
+    sSnifferCapture.mCounters.mRxOverflows++;
+    sSnifferCapture.mDroppedSinceBatch++;
+}
+
+uint16_t efr32SnifferCaptureRead(uint8_t *aBuffer, uint16_t aBufferLength)
+{
+    uint32_t head   = sSnifferCapture.mHead;
+    uint32_t tail   = sSnifferCapture.mTail;
+    uint16_t length = EFR32_SNIFFER_CAPTURE_BATCH_HEADER_SIZE;
+    uint16_t count  = 0;
+    uint32_t dropped;
+
+    CORE_DECLARE_IRQ_STATE;
+
+    while (tail != head)
+    {
+        uint32_t offset = tail & EFR32_SNIFFER_CAPTURE_MASK;
+        uint32_t size;
+
+        if (sSnifferCapture.mBuffer[offset] == 0)
+        {
+            tail += SL_OPENTHREAD_SNIFFER_CAPTURE_BUFFER_SIZE - offset;
+            continue;
+        }
+
+        size = EFR32_SNIFFER_CAPTURE_RECORD_HEADER_SIZE + sSnifferCapture.mBuffer[offset];
+
+        if ((uint32_t)length + size > aBufferLength)
+        {
+            break;
+        }
+
+        memcpy(&aBuffer[length], &sSnifferCapture.mBuffer[offset], size);
+        length += (uint16_t)size;
+        tail += size;
+        count++;
+    }
+
+    // The records are copied before the writer can reuse their space.
+    CORE_ENTER_ATOMIC();
+    sSnifferCapture.mTail              = tail;
+    dropped                            = sSnifferCapture.mDroppedSinceBatch;
+    sSnifferCapture.mDroppedSinceBatch = 0;
+    sSnifferCapture.mCounters.mBatches++;
+    CORE_EXIT_ATOMIC();
+
+    aBuffer[0] = (uint8_t)sSnifferCapture.mBatchSequence;
+    aBuffer[1] = (uint8_t)(sSnifferCapture.mBatchSequence >> 8);
+    aBuffer[2] = (uint8_t)count;
+    aBuffer[3] = (uint8_t)(count >> 8);
+    efr32SnifferCapturePut32(&aBuffer[4], dropped);
+    sSnifferCapture.mBatchSequence++;
+
+    return length;
+}
+
+void efr32SnifferCaptureReset(void)
+{
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    sSnifferCapture.mTail              = sSnifferCapture.mHead;
+    sSnifferCapture.mDroppedSinceBatch = 0;
+    sSnifferCapture.mBatchSequence     = 0;
+    memset(&sSnifferCapture.mCounters, 0, sizeof(sSnifferCapture.mCounters));
+    CORE_EXIT_ATOMIC();
+}
+
+void efr32SnifferCaptureGetCounters(efr32SnifferCaptureCounters *aCounters)
+{
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *aCounters = sSnifferCapture.mCounters;
+    CORE_EXIT_ATOMIC();
+}
+
+#endif // SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
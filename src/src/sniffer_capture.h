@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   Ring of the frames received in sniffer capture mode.
+ *
+ *   When SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE is set and a capture is running, the RAIL receive callback writes
+ *   every received frame as a record in a byte ring, instead of queueing it for otPlatRadioReceiveDone(). The
+ *   main loop drains the ring in batches, see otPlatRadioExtensionReadSnifferCapture() for the batch layout.
+ *
+ *   The ring has a single writer, the RAIL receive callback, and a single reader, the main loop. A record is
+ *   always contiguous: when it does not fit before the end of the ring, a zero length byte marks the remaining
+ *   bytes as padding and the record starts over at the beginning of the ring. A frame arriving while the ring
+ *   is full is dropped and counted.
+ */
+
+#ifndef SNIFFER_CAPTURE_H_
+#define SNIFFER_CAPTURE_H_
+
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+
+#include "sl_radio_extension.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+
+/**
+ * Reserves a record in the ring and fills its header.
+ *
+ * Must be called from the RAIL receive callback, and followed by efr32SnifferCaptureCommit() once the frame has
+ * been copied.
+ *
+ * @param[in]  aLength     The length of the frame, without the FCS.
+ * @param[in]  aTimestamp  The time of the end of the SFD, in microseconds.
+ * @param[in]  aRssi       The RSSI of the frame, in dBm.
+ * @param[in]  aLqi        The LQI of the frame.
+ * @param[in]  aChannel    The channel the frame was received on.
+ *
+ * @returns A pointer where to copy the frame, or NULL if the ring is full and the frame was dropped.
+ */
+uint8_t *efr32SnifferCaptureAlloc(uint8_t aLength, uint64_t aTimestamp, int8_t aRssi, uint8_t aLqi, uint8_t aChannel);
+
+/**
+ * Makes the record reserved by the last efr32SnifferCaptureAlloc() call visible to the reader.
+ */
+void efr32SnifferCaptureCommit(void);
+
+/**
+ * Counts a frame lost by the receiver before it could be captured.
+ */
+void efr32SnifferCaptureOnRxOverflow(void);
+
+/**
+ * Moves the oldest records of the ring into a batch.
+ *
+ * @param[out]  aBuffer        The buffer receiving the batch.
+ * @param[in]   aBufferLength  The length of @p aBuffer, at least EFR32_SNIFFER_CAPTURE_BATCH_HEADER_SIZE.
+ *
+ * @returns The length of the batch written to @p aBuffer.
+ */
+uint16_t efr32SnifferCaptureRead(uint8_t *aBuffer, uint16_t aBufferLength);
+
+/**
+ * Discards the captured records and clears the counters.
+ */
+void efr32SnifferCaptureReset(void);
+
+/**
+ * Reads the counters of the capture.
+ *
+ * @param[out]  aCounters  The counters.
+ */
+void efr32SnifferCaptureGetCounters(efr32SnifferCaptureCounters *aCounters);
+
+#endif // SL_OPENTHREAD_SNIFFER_CAPTURE_ENABLE
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SNIFFER_CAPTURE_H_
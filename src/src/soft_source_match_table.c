@@ -48,6 +48,8 @@
 #include "common/debug.hpp"
 #include "utils/code_utils.h"
 
+#include "logging_plat.h"
+
 // Print entire source match tables when
 #define PRINT_MULTIPAN_SOURCE_MATCH_TABLES 0
 
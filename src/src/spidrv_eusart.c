@@ -53,6 +53,7 @@
 #include "sl_ncp_spidrv_eusart_config.h"
 
 #include "platform-efr32.h"
+#include <openthread-core-config.h>
 #include <openthread-system.h>
 #include <openthread/error.h>
 #include <openthread/platform/spi-slave.h>
@@ -62,6 +63,11 @@
 // DEFINES
 #define MAX_DMA_DESCRIPTOR_TRANSFER_COUNT ((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U)
 
+// Number of linked descriptors needed to cover the largest supported transaction.
+#define MAX_DMA_DESCRIPTOR_CHAIN_LENGTH                                                \
+    ((SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE + MAX_DMA_DESCRIPTOR_TRANSFER_COUNT - 1U) \
+     / MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+
 #define SL_OT_SPIDRV_SPI_CONCAT_PASTER(first, second, third) first##second##third
 
 #define SL_OT_SPIDRV_SPI_LDMA_RX_PERIPH_TRIGGER(periph_nbr) \
@@ -76,10 +82,22 @@ static volatile bool should_process_transaction = false;
 static sl_hal_ldma_transfer_config_t rx_dma_transfer_config;
 static sl_hal_ldma_transfer_config_t tx_dma_transfer_config;
 
-static uint8_t                           default_tx_value;
-static volatile sl_hal_ldma_descriptor_t tx_descriptor[2];
+static uint8_t default_tx_value;
+
+// The tx chain holds the output buffer descriptors followed by the default value descriptor,
+// which keeps clocking out default_tx_value once the output buffer is exhausted.
+static volatile sl_hal_ldma_descriptor_t tx_descriptor[MAX_DMA_DESCRIPTOR_CHAIN_LENGTH + 1U];
+static volatile sl_hal_ldma_descriptor_t rx_descriptor[MAX_DMA_DESCRIPTOR_CHAIN_LENGTH];
+
+static sl_hal_ldma_descriptor_t tx_link_descriptor;
+static sl_hal_ldma_descriptor_t tx_default_value_descriptor;
+static sl_hal_ldma_descriptor_t rx_link_descriptor;
+static sl_hal_ldma_descriptor_t rx_last_descriptor;
 
-static volatile sl_hal_ldma_descriptor_t rx_descriptor;
+static uint8_t *volatile tx_buffer;
+static uint8_t *volatile rx_buffer;
+static volatile uint16_t tx_buffer_length;
+static volatile uint16_t rx_buffer_length;
 
 // TRANSACTION EVENT'S CALLBACK
 static volatile otPlatSpiSlaveTransactionCompleteCallback complete_callback;
@@ -134,6 +152,61 @@ static void clearEusartFifos(EUSART_TypeDef *eusart)
 #endif
 }
 
+static void rcp_spidrv_chain_tx_descriptors(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint8_t  index  = 0U;
+    uint16_t offset = 0U;
+
+    while (offset < aLength)
+    {
+        uint16_t chunk = aLength - offset;
+
+        if (chunk > MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+        {
+            chunk = MAX_DMA_DESCRIPTOR_TRANSFER_COUNT;
+        }
+
+        tx_descriptor[index]                 = tx_link_descriptor;
+        tx_descriptor[index].xfer.xfer_count = chunk - 1U;
+        tx_descriptor[index].xfer.src_addr   = (uint32_t)&aBuffer[offset];
+
+        offset += chunk;
+        index++;
+    }
+
+    // The default value descriptor always directly follows the last output buffer descriptor.
+    tx_descriptor[index] = tx_default_value_descriptor;
+
+    tx_buffer        = aBuffer;
+    tx_buffer_length = aLength;
+}
+
+static void rcp_spidrv_chain_rx_descriptors(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint8_t  index  = 0U;
+    uint16_t offset = 0U;
+
+    do
+    {
+        uint16_t chunk = aLength - offset;
+
+        if (chunk > MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+        {
+            chunk = MAX_DMA_DESCRIPTOR_TRANSFER_COUNT;
+        }
+
+        rx_descriptor[index] = ((offset + chunk) < aLength) ? rx_link_descriptor : rx_last_descriptor;
+        rx_descriptor[index].xfer.xfer_count = chunk - 1U;
+        rx_descriptor[index].xfer.dst_addr   = (uint32_t)&aBuffer[offset];
+
+        offset += chunk;
+        index++;
+    } while (offset < aLength);
+
+    rx_buffer        = aBuffer;
+    rx_buffer_length = aLength;
+}
+
 static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo, void *ctx)
 {
     OT_UNUSED_VARIABLE(ctx);
@@ -167,28 +240,38 @@ static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo, void *ctx)
     uint32_t tx_dma_channel_remaining_xfercnt =
         (LDMA0->CH[tx_dma_channel_nb].CTRL & _LDMA_CH_CTRL_XFERCNT_MASK) >> _LDMA_CH_CTRL_XFERCNT_SHIFT;
     tx_dma_channel_remaining_xfercnt += 1U;
-    tx_dma_channel_remaining_xfercnt +=
-        (sl_spidrv_handle_data.peripheral.eusartPort->STATUS & _EUSART_STATUS_TXFCNT_MASK)
-        >> _EUSART_STATUS_TXFCNT_SHIFT;
 
-    uint32_t current_tx_descritor_link =
-        (LDMA0->CH[tx_dma_channel_nb].LINK & _LDMA_CH_LINK_LINK_MASK) >> _LDMA_CH_LINK_LINK_SHIFT;
+    uint32_t tx_fifo_count = (sl_spidrv_handle_data.peripheral.eusartPort->STATUS & _EUSART_STATUS_TXFCNT_MASK)
+                             >> _EUSART_STATUS_TXFCNT_SHIFT;
 
-    uint8_t *old_tx_buffer      = (uint8_t *)tx_descriptor[0].xfer.src_addr;
-    uint16_t old_tx_buffer_size = tx_descriptor[0].xfer.xfer_count + 1U;
+    uint32_t current_tx_src_addr = LDMA0->CH[tx_dma_channel_nb].SRC;
 
-    uint8_t *old_rx_buffer      = (uint8_t *)rx_descriptor.xfer.dst_addr;
-    uint16_t old_rx_buffer_size = rx_descriptor.xfer.xfer_count + 1U;
+    uint8_t *old_tx_buffer      = tx_buffer;
+    uint16_t old_tx_buffer_size = tx_buffer_length;
 
-    if (current_tx_descritor_link == 0U)
+    uint8_t *old_rx_buffer      = rx_buffer;
+    uint16_t old_rx_buffer_size = rx_buffer_length;
+
+    if (current_tx_src_addr == (uint32_t)&default_tx_value)
     {
-        // Since the link bit is not set in the tx dma channel descriptor the second tx descriptor was loaded.
-        tx_transaction_size = tx_descriptor[0].xfer.xfer_count + 1U;
-        tx_transaction_size += (tx_descriptor[1].xfer.xfer_count + 1U) - tx_dma_channel_remaining_xfercnt;
+        // The default value descriptor was loaded, so every descriptor of the output buffer chain was consumed.
+        tx_transaction_size = old_tx_buffer_size;
+        tx_transaction_size += (tx_default_value_descriptor.xfer.xfer_count + 1U) - tx_dma_channel_remaining_xfercnt;
     }
     else
     {
-        tx_transaction_size = (tx_descriptor[0].xfer.xfer_count - tx_dma_channel_remaining_xfercnt) + 1U;
+        // The source address keeps incrementing across the linked output buffer descriptors.
+        tx_transaction_size = current_tx_src_addr - (uint32_t)old_tx_buffer;
+    }
+
+    // Bytes still waiting in the TX FIFO were fetched by the DMA but never clocked out.
+    tx_transaction_size = (tx_transaction_size > tx_fifo_count) ? (tx_transaction_size - tx_fifo_count) : 0U;
+
+    // The callback takes a 16 bit length. The config-check keeps SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE within
+    // 16 bits, so clamping to it makes the narrowing below lossless.
+    if (tx_transaction_size > SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE)
+    {
+        tx_transaction_size = SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE;
     }
 
     // call's otPlatSpiSlavePrepareTransaction in the background, the DMA buffer's will be ready after this call.
@@ -197,7 +280,7 @@ static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo, void *ctx)
                           old_tx_buffer_size,
                           (uint8_t *)old_rx_buffer,
                           old_rx_buffer_size,
-                          tx_transaction_size))
+                          (uint16_t)tx_transaction_size))
     {
         otSysEventSignalPending();
         should_process_transaction = true;
@@ -258,28 +341,41 @@ otError otPlatSpiSlaveEnable(otPlatSpiSlaveTransactionCompleteCallback aComplete
     tx_dma_transfer_config = (sl_hal_ldma_transfer_config_t)SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(
         SL_OT_SPIDRV_SPI_LDMA_TX_PERIPH_TRIGGER(SL_NCP_SPIDRV_EUSART_PERIPHERAL_NO));
 
-    rx_descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_P2M(
+    rx_link_descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKREL_P2M(
+        SL_HAL_LDMA_CTRL_SIZE_BYTE,
+        &(sl_spidrv_handle_data.peripheral.eusartPort->RXDATA),
+        NULL,
+        1U,
+        1);
+    rx_link_descriptor.xfer.done_ifs = 0U;
+
+    rx_last_descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_P2M(
         SL_HAL_LDMA_CTRL_SIZE_BYTE,
         &(sl_spidrv_handle_data.peripheral.eusartPort->RXDATA),
         NULL,
         1U);
-    rx_descriptor.xfer.done_ifs = 0U;
+    rx_last_descriptor.xfer.done_ifs = 0U;
 
-    tx_descriptor[0] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKREL_M2P(
+    tx_link_descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKREL_M2P(
         SL_HAL_LDMA_CTRL_SIZE_BYTE,
         &default_tx_value,
         &(sl_spidrv_handle_data.peripheral.eusartPort->TXDATA),
         1,
         1);
-    tx_descriptor[0].xfer.done_ifs = 0U;
+    tx_link_descriptor.xfer.done_ifs = 0U;
 
-    tx_descriptor[1] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(
+    tx_default_value_descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(
         SL_HAL_LDMA_CTRL_SIZE_BYTE,
         &default_tx_value,
         &(sl_spidrv_handle_data.peripheral.eusartPort->TXDATA),
         MAX_DMA_DESCRIPTOR_TRANSFER_COUNT);
-    tx_descriptor[1].xfer.src_inc  = SL_HAL_LDMA_CTRL_SRC_INC_NONE;
-    tx_descriptor[1].xfer.done_ifs = 0U;
+    tx_default_value_descriptor.xfer.src_inc  = SL_HAL_LDMA_CTRL_SRC_INC_NONE;
+    tx_default_value_descriptor.xfer.done_ifs = 0U;
+
+    // No buffers yet: only the default value descriptor is chained.
+    rcp_spidrv_chain_tx_descriptors(NULL, 0U);
+    rx_buffer        = NULL;
+    rx_buffer_length = 0U;
 
     // Configuring Host INT line. Active low
 #if defined(SL_NCP_SPIDRV_EUSART_HOST_INT_PORT) && defined(SL_NCP_SPIDRV_EUSART_HOST_INT_PIN)
@@ -320,7 +416,7 @@ otError otPlatSpiSlaveEnable(otPlatSpiSlaveTransactionCompleteCallback aComplete
     sl_hal_ldma_init_transfer(LDMA0,
                               sl_spidrv_handle_data.txDMACh,
                               (sl_hal_ldma_transfer_config_t *)&tx_dma_transfer_config,
-                              (sl_hal_ldma_descriptor_t *)&tx_descriptor[1]);
+                              (sl_hal_ldma_descriptor_t *)&tx_descriptor[0]);
     sl_hal_ldma_start_transfer(LDMA0, sl_spidrv_handle_data.txDMACh);
 
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
@@ -378,8 +474,8 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
 
     otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(aOutputBufLen <= MAX_DMA_DESCRIPTOR_TRANSFER_COUNT, error = OT_ERROR_FAILED);
-    VerifyOrExit(aInputBufLen <= MAX_DMA_DESCRIPTOR_TRANSFER_COUNT, error = OT_ERROR_FAILED);
+    VerifyOrExit(aOutputBufLen <= SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE, error = OT_ERROR_FAILED);
+    VerifyOrExit(aInputBufLen <= SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE, error = OT_ERROR_FAILED);
 
     uint32_t tx_dma_channel_number = sl_spidrv_handle_data.txDMACh;
     uint32_t rx_dma_channel_number = sl_spidrv_handle_data.rxDMACh;
@@ -414,14 +510,12 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
             clearEusartFifos(sl_spidrv_handle_data.peripheral.eusartPort);
         }
 
-        tx_descriptor[0].xfer.xfer_count = aOutputBufLen - 1U;
-        tx_descriptor[0].xfer.src_addr   = (uint32_t)aOutputBuf;
+        rcp_spidrv_chain_tx_descriptors(aOutputBuf, aOutputBufLen);
     }
 
     if (aInputBuf != NULL)
     {
-        rx_descriptor.xfer.xfer_count = aInputBufLen - 1U;
-        rx_descriptor.xfer.dst_addr   = (uint32_t)aInputBuf;
+        rcp_spidrv_chain_rx_descriptors(aInputBuf, aInputBufLen);
     }
 
     VerifyOrExit(sl_hal_gpio_get_pin_input(&cs_gpio), error = OT_ERROR_BUSY);
@@ -440,7 +534,7 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
         sl_hal_ldma_init_transfer(LDMA0,
                                   rx_dma_channel_number,
                                   (sl_hal_ldma_transfer_config_t *)&rx_dma_transfer_config,
-                                  (sl_hal_ldma_descriptor_t *)&rx_descriptor);
+                                  (sl_hal_ldma_descriptor_t *)&(rx_descriptor[0]));
         sl_hal_ldma_start_transfer(LDMA0, rx_dma_channel_number);
     }
 
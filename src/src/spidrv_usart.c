@@ -53,6 +53,7 @@
 #include "sl_ncp_spidrv_usart_config.h"
 
 #include "platform-efr32.h"
+#include <openthread-core-config.h>
 #include <openthread-system.h>
 #include <openthread/error.h>
 #include <openthread/platform/spi-slave.h>
@@ -61,6 +62,11 @@
 // DEFINES
 #define MAX_DMA_DESCRIPTOR_TRANSFER_COUNT ((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U)
 
+// Number of linked descriptors needed to cover the largest supported transaction.
+#define MAX_DMA_DESCRIPTOR_CHAIN_LENGTH                                                \
+    ((SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE + MAX_DMA_DESCRIPTOR_TRANSFER_COUNT - 1U) \
+     / MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+
 #define SL_OT_SPIDRV_SPI_CONCAT_PASTER(first, second, third) first##second##third
 
 #define SL_OT_SPIDRV_SPI_LDMA_RX_PERIPH_TRIGGER(periph_nbr) \
@@ -75,10 +81,22 @@ static volatile bool should_process_transaction = false;
 static LDMA_TransferCfg_t rx_dma_transfer_config;
 static LDMA_TransferCfg_t tx_dma_transfer_config;
 
-static uint8_t                    default_tx_value;
-static volatile LDMA_Descriptor_t tx_descriptor[2];
+static uint8_t default_tx_value;
+
+// The tx chain holds the output buffer descriptors followed by the default value descriptor,
+// which keeps clocking out default_tx_value once the output buffer is exhausted.
+static volatile LDMA_Descriptor_t tx_descriptor[MAX_DMA_DESCRIPTOR_CHAIN_LENGTH + 1U];
+static volatile LDMA_Descriptor_t rx_descriptor[MAX_DMA_DESCRIPTOR_CHAIN_LENGTH];
+
+static LDMA_Descriptor_t tx_link_descriptor;
+static LDMA_Descriptor_t tx_default_value_descriptor;
+static LDMA_Descriptor_t rx_link_descriptor;
+static LDMA_Descriptor_t rx_last_descriptor;
 
-static volatile LDMA_Descriptor_t rx_descriptor;
+static uint8_t *volatile tx_buffer;
+static uint8_t *volatile rx_buffer;
+static volatile uint16_t tx_buffer_length;
+static volatile uint16_t rx_buffer_length;
 
 // TRANSACTION EVENT'S CALLBACK
 static volatile otPlatSpiSlaveTransactionCompleteCallback complete_callback;
@@ -108,6 +126,61 @@ static void rcp_spidrv_deassert_host_request(void)
 #endif
 }
 
+static void rcp_spidrv_chain_tx_descriptors(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint8_t  index  = 0U;
+    uint16_t offset = 0U;
+
+    while (offset < aLength)
+    {
+        uint16_t chunk = aLength - offset;
+
+        if (chunk > MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+        {
+            chunk = MAX_DMA_DESCRIPTOR_TRANSFER_COUNT;
+        }
+
+        tx_descriptor[index]              = tx_link_descriptor;
+        tx_descriptor[index].xfer.xferCnt = chunk - 1U;
+        tx_descriptor[index].xfer.srcAddr = (uint32_t)&aBuffer[offset];
+
+        offset += chunk;
+        index++;
+    }
+
+    // The default value descriptor always directly follows the last output buffer descriptor.
+    tx_descriptor[index] = tx_default_value_descriptor;
+
+    tx_buffer        = aBuffer;
+    tx_buffer_length = aLength;
+}
+
+static void rcp_spidrv_chain_rx_descriptors(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint8_t  index  = 0U;
+    uint16_t offset = 0U;
+
+    do
+    {
+        uint16_t chunk = aLength - offset;
+
+        if (chunk > MAX_DMA_DESCRIPTOR_TRANSFER_COUNT)
+        {
+            chunk = MAX_DMA_DESCRIPTOR_TRANSFER_COUNT;
+        }
+
+        rx_descriptor[index]              = ((offset + chunk) < aLength) ? rx_link_descriptor : rx_last_descriptor;
+        rx_descriptor[index].xfer.xferCnt = chunk - 1U;
+        rx_descriptor[index].xfer.dstAddr = (uint32_t)&aBuffer[offset];
+
+        offset += chunk;
+        index++;
+    } while (offset < aLength);
+
+    rx_buffer        = aBuffer;
+    rx_buffer_length = aLength;
+}
+
 static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo)
 {
     if (intNo == SL_NCP_SPIDRV_USART_CS_FALLING_EDGE_INT_NO)
@@ -139,28 +212,38 @@ static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo)
     uint32_t tx_dma_channel_remaining_xfercnt =
         (LDMA->CH[tx_dma_channel_nb].CTRL & _LDMA_CH_CTRL_XFERCNT_MASK) >> _LDMA_CH_CTRL_XFERCNT_SHIFT;
     tx_dma_channel_remaining_xfercnt += 1U;
-    tx_dma_channel_remaining_xfercnt +=
-        (sl_spidrv_handle_data.peripheral.usartPort->STATUS & _USART_STATUS_TXBUFCNT_MASK)
-        >> _USART_STATUS_TXBUFCNT_SHIFT;
 
-    uint32_t current_tx_descritor_link =
-        (LDMA->CH[tx_dma_channel_nb].LINK & _LDMA_CH_LINK_LINK_MASK) >> _LDMA_CH_LINK_LINK_SHIFT;
+    uint32_t tx_fifo_count = (sl_spidrv_handle_data.peripheral.usartPort->STATUS & _USART_STATUS_TXBUFCNT_MASK)
+                             >> _USART_STATUS_TXBUFCNT_SHIFT;
 
-    uint8_t *old_tx_buffer      = (uint8_t *)tx_descriptor[0].xfer.srcAddr;
-    uint16_t old_tx_buffer_size = tx_descriptor[0].xfer.xferCnt + 1U;
+    uint32_t current_tx_src_addr = LDMA->CH[tx_dma_channel_nb].SRC;
 
-    uint8_t *old_rx_buffer      = (uint8_t *)rx_descriptor.xfer.dstAddr;
-    uint16_t old_rx_buffer_size = rx_descriptor.xfer.xferCnt + 1U;
+    uint8_t *old_tx_buffer      = tx_buffer;
+    uint16_t old_tx_buffer_size = tx_buffer_length;
 
-    if (current_tx_descritor_link == 0U)
+    uint8_t *old_rx_buffer      = rx_buffer;
+    uint16_t old_rx_buffer_size = rx_buffer_length;
+
+    if (current_tx_src_addr == (uint32_t)&default_tx_value)
     {
-        // Since the link bit is not set in the tx dma channel descriptor the second tx descriptor was loaded.
-        tx_transaction_size = tx_descriptor[0].xfer.xferCnt + 1U;
-        tx_transaction_size += (tx_descriptor[1].xfer.xferCnt + 1U) - tx_dma_channel_remaining_xfercnt;
+        // The default value descriptor was loaded, so every descriptor of the output buffer chain was consumed.
+        tx_transaction_size = old_tx_buffer_size;
+        tx_transaction_size += (tx_default_value_descriptor.xfer.xferCnt + 1U) - tx_dma_channel_remaining_xfercnt;
     }
     else
     {
-        tx_transaction_size = (tx_descriptor[0].xfer.xferCnt - tx_dma_channel_remaining_xfercnt) + 1U;
+        // The source address keeps incrementing across the linked output buffer descriptors.
+        tx_transaction_size = current_tx_src_addr - (uint32_t)old_tx_buffer;
+    }
+
+    // Bytes still waiting in the TX buffer were fetched by the DMA but never clocked out.
+    tx_transaction_size = (tx_transaction_size > tx_fifo_count) ? (tx_transaction_size - tx_fifo_count) : 0U;
+
+    // The callback takes a 16 bit length. The config-check keeps SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE within
+    // 16 bits, so clamping to it makes the narrowing below lossless.
+    if (tx_transaction_size > SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE)
+    {
+        tx_transaction_size = SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE;
     }
 
     // call's otPlatSpiSlavePrepareTransaction in the background, the DMA buffer's will be ready after this call.
@@ -169,7 +252,7 @@ static void rcp_spidrv_spi_transaction_end_interrupt(uint8_t intNo)
                           old_tx_buffer_size,
                           (uint8_t *)old_rx_buffer,
                           old_rx_buffer_size,
-                          tx_transaction_size))
+                          (uint16_t)tx_transaction_size))
     {
         otSysEventSignalPending();
         should_process_transaction = true;
@@ -237,25 +320,37 @@ otError otPlatSpiSlaveEnable(otPlatSpiSlaveTransactionCompleteCallback aComplete
     tx_dma_transfer_config = (LDMA_TransferCfg_t)LDMA_TRANSFER_CFG_PERIPHERAL(
         SL_OT_SPIDRV_SPI_LDMA_TX_PERIPH_TRIGGER(SL_NCP_SPIDRV_USART_PERIPHERAL_NO));
 
-    rx_descriptor =
+    rx_link_descriptor =
+        (LDMA_Descriptor_t)LDMA_DESCRIPTOR_LINKREL_P2M_BYTE(&(sl_spidrv_handle_data.peripheral.usartPort->RXDATA),
+                                                            NULL,
+                                                            1U,
+                                                            1);
+    rx_link_descriptor.xfer.doneIfs = 0U;
+
+    rx_last_descriptor =
         (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&(sl_spidrv_handle_data.peripheral.usartPort->RXDATA),
                                                            NULL,
                                                            1U);
-    rx_descriptor.xfer.doneIfs = 0U;
+    rx_last_descriptor.xfer.doneIfs = 0U;
 
-    tx_descriptor[0] =
+    tx_link_descriptor =
         (LDMA_Descriptor_t)LDMA_DESCRIPTOR_LINKREL_M2P_BYTE(&default_tx_value,
                                                             &(sl_spidrv_handle_data.peripheral.usartPort->TXDATA),
                                                             1,
                                                             1);
-    tx_descriptor[0].xfer.doneIfs = 0U;
+    tx_link_descriptor.xfer.doneIfs = 0U;
 
-    tx_descriptor[1] =
+    tx_default_value_descriptor =
         (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(&default_tx_value,
                                                            &(sl_spidrv_handle_data.peripheral.usartPort->TXDATA),
                                                            MAX_DMA_DESCRIPTOR_TRANSFER_COUNT);
-    tx_descriptor[1].xfer.srcInc  = ldmaCtrlSrcIncNone;
-    tx_descriptor[1].xfer.doneIfs = 0U;
+    tx_default_value_descriptor.xfer.srcInc  = ldmaCtrlSrcIncNone;
+    tx_default_value_descriptor.xfer.doneIfs = 0U;
+
+    // No buffers yet: only the default value descriptor is chained.
+    rcp_spidrv_chain_tx_descriptors(NULL, 0U);
+    rx_buffer        = NULL;
+    rx_buffer_length = 0U;
 
     // Configuring Host INT line. Active low
 #if defined(SL_NCP_SPIDRV_USART_HOST_INT_PORT) && defined(SL_NCP_SPIDRV_USART_HOST_INT_PIN)
@@ -291,7 +386,7 @@ otError otPlatSpiSlaveEnable(otPlatSpiSlaveTransactionCompleteCallback aComplete
     // Load the default value descriptor.
     LDMA_StartTransfer(sl_spidrv_handle_data.txDMACh,
                        (LDMA_TransferCfg_t *)&tx_dma_transfer_config,
-                       (LDMA_Descriptor_t *)&tx_descriptor[1]);
+                       (LDMA_Descriptor_t *)&tx_descriptor[0]);
 
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
     sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
@@ -359,8 +454,8 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
 
     otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(aOutputBufLen <= MAX_DMA_DESCRIPTOR_TRANSFER_COUNT, error = OT_ERROR_FAILED);
-    VerifyOrExit(aInputBufLen <= MAX_DMA_DESCRIPTOR_TRANSFER_COUNT, error = OT_ERROR_FAILED);
+    VerifyOrExit(aOutputBufLen <= SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE, error = OT_ERROR_FAILED);
+    VerifyOrExit(aInputBufLen <= SL_OPENTHREAD_SPI_MAX_TRANSACTION_SIZE, error = OT_ERROR_FAILED);
 
     uint32_t tx_dma_channel_number = sl_spidrv_handle_data.txDMACh;
     uint32_t rx_dma_channel_number = sl_spidrv_handle_data.rxDMACh;
@@ -396,8 +491,7 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
             sl_spidrv_handle_data.peripheral.usartPort->CMD = USART_CMD_CLEARTX;
         }
 
-        tx_descriptor[0].xfer.xferCnt = aOutputBufLen - 1U;
-        tx_descriptor[0].xfer.srcAddr = (uint32_t)aOutputBuf;
+        rcp_spidrv_chain_tx_descriptors(aOutputBuf, aOutputBufLen);
 
         // Wait until Tx fifo clears up.
         while (sl_spidrv_handle_data.peripheral.usartPort->STATUS & _USART_STATUS_TXBUFCNT_MASK);
@@ -405,8 +499,7 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
 
     if (aInputBuf != NULL)
     {
-        rx_descriptor.xfer.xferCnt = aInputBufLen - 1U;
-        rx_descriptor.xfer.dstAddr = (uint32_t)aInputBuf;
+        rcp_spidrv_chain_rx_descriptors(aInputBuf, aInputBufLen);
     }
 
     VerifyOrExit(GPIO_PinInGet(SL_NCP_SPIDRV_USART_CS_PORT, SL_NCP_SPIDRV_USART_CS_PIN), error = OT_ERROR_BUSY);
@@ -422,7 +515,7 @@ otError otPlatSpiSlavePrepareTransaction(uint8_t *aOutputBuf,
     {
         LDMA_StartTransfer(rx_dma_channel_number,
                            (LDMA_TransferCfg_t *)&rx_dma_transfer_config,
-                           (LDMA_Descriptor_t *)&rx_descriptor);
+                           (LDMA_Descriptor_t *)&(rx_descriptor[0]));
     }
 
     if (aRequestTransactionFlag)
@@ -128,6 +128,18 @@ OT_TOOL_WEAK void app_init(void)
     // Placeholder for any application specific initialization
 }
 
+#if USE_EFR32_LOG && SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+OT_TOOL_WEAK void efr32LogProcess(void)
+{
+    // Placeholder for logging backends which do not queue log records
+}
+
+OT_TOOL_WEAK bool efr32LogIsPending(void)
+{
+    return false;
+}
+#endif
+
 OT_TOOL_WEAK void otSysEventSignalPending(void)
 {
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
@@ -201,9 +213,18 @@ void otSysProcessDrivers(otInstance *aInstance)
 
     efr32RadioProcess(aInstance);
 
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+    efr32DiagProcess();
+#endif
+
     // See alarm.c: Wrapped in a critical section
     efr32AlarmProcess(aInstance);
 
+#if USE_EFR32_LOG && SL_OPENTHREAD_DEFERRED_LOG_ENABLE
+    // Write the log records queued while processing, before the system is allowed to sleep.
+    efr32LogProcess();
+#endif
+
 #if !defined(SL_CATALOG_KERNEL_PRESENT)
     otSysEventSignalPending();
 #endif